@@ -268,14 +268,14 @@ namespace tgui
         // This function is a (slow) way to set properties on the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool setProperty(std::string property, const std::string& value);
+        virtual bool setProperty(const std::string& property, const std::string& value);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // This function is a (slow) way to get properties of the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool getProperty(std::string property, std::string& value) const;
+        virtual bool getProperty(const std::string& property, std::string& value) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,6 +289,13 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // This function is called when the widget is added to a container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void initialize(Container *const container);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // When the elapsed time changes then this function is called.
@@ -296,6 +303,13 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the time until the next frame has to be shown.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // Draws the widget on the render target.
@@ -28,6 +28,9 @@
 
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/TextMetrics.hpp>
+
+#include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -454,14 +457,14 @@ namespace tgui
         // This function is a (slow) way to set properties on the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool setProperty(std::string property, const std::string& value);
+        virtual bool setProperty(const std::string& property, const std::string& value);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // This function is a (slow) way to get properties of the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool getProperty(std::string property, std::string& value) const;
+        virtual bool getProperty(const std::string& property, std::string& value) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,12 +476,55 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      private:
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // A line that was added with addLine. The text is split over multiple rows when it doesn't fit on one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Line
+        {
+            // The text that was passed to addLine
+            sf::String text;
+
+            // The text that is drawn, with a newline at every place where the text was wrapped
+            sf::Text wrappedText;
+
+            // The font that was passed to addLine, or nullptr when the default font is used
+            const sf::Font* font;
+
+            // The amount of rows that the text was split over
+            unsigned int rows;
+
+            // The distance from the top of the first line that was ever added (minus the heights of removed lines in front of
+            // it) and the height that the line occupies
+            float top;
+            float height;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text of the line over multiple rows so that it fits inside the chat box.
+        // Rows are broken after the last space that fits on them, words that don't fit on a row by themselves are split.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wrapLine(Line& line);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Retrieve the space of one of the lines.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int getLineSpacing(unsigned int lineNumber);
+        float getLineHeight(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the tops of the lines starting from the given line, after the heights of the lines have changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateLineTops(unsigned int firstLine);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the first line that ends below the given distance from the top of the first line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findLineBelow(float position) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -493,7 +539,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
-        // Update the position of the labels.
+        // Finds out which lines are visible and updates their positions.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateDisplayedText();
 
@@ -532,7 +578,17 @@ namespace tgui
 
         float m_FullTextHeight;
 
-        // The panel containing the labels
+        // The lines in the chat box. New lines are added at the back and the oldest lines are removed from the front.
+        std::deque<Line> m_Lines;
+
+        // The lines from m_FirstVisibleLine until (but not including) m_LastVisibleLine are drawn
+        unsigned int m_FirstVisibleLine;
+        unsigned int m_LastVisibleLine;
+
+        // Caches the advances of the glyphs that are used to wrap the lines
+        TextMetrics m_TextMetrics;
+
+        // The panel that draws the background
         Panel* m_Panel;
 
         // The scrollbar
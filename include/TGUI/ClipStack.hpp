@@ -0,0 +1,168 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#ifndef TGUI_CLIP_STACK_HPP
+#define TGUI_CLIP_STACK_HPP
+
+
+#include <TGUI/Defines.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Keeps track of the area in which the widgets may draw while the gui is being drawn.
+    // Widgets that clip their contents push their area and pop it again when they are done. The area is intersected with
+    // the one of the widget around it on the cpu, so the current clipping area never has to be read back from OpenGL.
+    // The gui and the render caches put their stack in the container that they are drawing, the widgets find it through
+    // their parents (see Widget::getClipStack).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ClipStack
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ClipStack();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Starts clipping on the given target, which must be active. The whole target is visible until a widget pushes a
+        // smaller area, unless the scissor test was already enabled, in which case the old scissor box is respected.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Puts the scissor test back in the state it had before begin was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Limits drawing to the part of the current area that lies between the two points, which are given in the coordinates
+        // of the view relative to its top left corner. Returns false when nothing that is drawn would be visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool push(const sf::RenderTarget& target, const sf::Vector2f& topLeft, const sf::Vector2f& bottomRight);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Goes back to the area from before the last call to push.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pop();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Checks whether a part of the rectangle, in the coordinates of the view, lies inside the current area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isVisible(const sf::RenderTarget& target, const sf::FloatRect& rect) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Area in pixels, measured from the top left corner of the target
+        struct Area
+        {
+            int left;
+            int top;
+            int right;
+            int bottom;
+        };
+
+        // Passes the area on top of the stack to OpenGL
+        void applyArea() const;
+
+        std::vector<Area> m_Areas;
+        unsigned int      m_TargetHeight;
+
+        // The scissor state from before begin was called, in the order that OpenGL uses (left, bottom, width, height)
+        bool m_PreviousScissorEnabled;
+        int  m_PreviousScissor[4];
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Limits drawing to the area of a widget while it draws its contents. The area is pushed on the clip stack that was
+    // found for the widget. When the widget is drawn directly on a target, outside of the gui, then there is no such stack
+    // and a stack is started on the current scissor state of the target instead.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Clipping
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Clipping();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Pushes the area between the two points (see ClipStack::push) on the given stack, or on a stack of its own when the
+        // given stack is a null pointer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(ClipStack* clipStack, const sf::RenderTarget& target, const sf::Vector2f& topLeft, const sf::Vector2f& bottomRight);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Goes back to the area from before begin was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        ClipStack* m_ClipStack;
+        ClipStack  m_OwnClipStack;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_CLIP_STACK_HPP
@@ -30,6 +30,8 @@
 #include <TGUI/Defines.hpp>
 
 #include <fstream>
+#include <ctime>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +45,12 @@ namespace tgui
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ConfigFile();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Destructor. Closes the file if still open.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +59,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Open a given file. If a file is already open then it will be closed first.
+        // The whole file is parsed the first time that it is opened. As long as the file isn't modified, opening it again
+        // will reuse the parsed sections without reading the file.
         //
         // return:  true when the file was opened
         //          false when it couldn't be opened
@@ -82,7 +92,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Reads an int rectangle from a string value.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool readIntRect(std::string value, sf::IntRect& rect) const;
+        bool readIntRect(const std::string& value, sf::IntRect& rect) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,6 +110,28 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
+        // The properties and values of a single section, and the lines in that section that couldn't be parsed
+        struct Section
+        {
+            std::vector<std::string> properties;
+            std::vector<std::string> values;
+            std::vector<unsigned int> errorLines;
+        };
+
+        // All sections of a file, stored with their name in lowercase (without the colon)
+        struct ParsedFile
+        {
+            std::time_t modificationTime;
+            std::unordered_map<std::string, Section> sections;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads all sections from the opened file in a single pass over its contents.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseFile(ParsedFile& parsedFile);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Remove the whitespace from the line, starting from the character c.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -107,21 +139,39 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Reads the next word, starting from character c.
+        // Reads an int rectangle from the characters in the given range. The closing bracket has to be the last character.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::string readWord(const std::string& line, std::string::const_iterator& c) const;
+        bool readIntRect(const char* value, std::size_t length, sf::IntRect& rect) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check if line is a section header.
+        // Checks if the character is a space, tab or carriage return.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool isSection(const std::string& line, std::string::const_iterator c, std::string& sectionName) const;
+        static bool isWhitespace(char c);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the first character in the range that isn't whitespace, or end when there is no such character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const char* skipWhitespace(const char* c, const char* end);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a lowercase copy of the characters in the range.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string toLowerRange(const char* begin, const char* end);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
         std::ifstream m_File;
+
+        // The parsed contents of the opened file
+        const ParsedFile* m_ParsedFile;
+
+        // The files that were already parsed, shared by all config files
+        static std::unordered_map<std::string, ParsedFile> m_ParsedFiles;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,10 @@
 
 
 #include <list>
+#include <fstream>
+#include <typeinfo>
+#include <functional>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
 
@@ -46,6 +50,9 @@ namespace tgui
 
         typedef SharedWidgetPtr<Container> Ptr;
 
+        // Function that creates a widget with the given name inside the given container
+        typedef std::function<Widget::Ptr(Container&, const sf::String&)> WidgetFactory;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Default constructor
@@ -121,6 +128,8 @@ namespace tgui
         ///
         /// \return Vector of all widget pointers
         ///
+        /// \warning Widgets should only be added, removed or reordered with the functions of the container.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::vector< Widget::Ptr >& getWidgets();
 
@@ -130,6 +139,8 @@ namespace tgui
         ///
         /// \return Vector of all widget names
         ///
+        /// \warning Widgets should only be renamed with the setWidgetName function.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::vector<sf::String>& getWidgetNames();
 
@@ -213,6 +224,26 @@ namespace tgui
         Widget::Ptr copy(const Widget::Ptr& oldWidget, const sf::String& newWidgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes several copies of an existing widget at once.
+        ///
+        /// This gives the same result as calling copy for every name, but the lists of the container only grow once.
+        ///
+        /// \param oldWidget       A pointer to the old widget.
+        /// \param newWidgetNames  The names of the new widgets, one copy is made for every name
+        ///
+        /// \return Pointers to the new widgets, in the same order as the names
+        ///
+        /// Usage example:
+        /// \code
+        /// tgui::Button::Ptr row(container, "RowTemplate");
+        /// std::vector<tgui::Widget::Ptr> rows = container.copy(row, {"Row1", "Row2", "Row3"});
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<Widget::Ptr> copy(const Widget::Ptr& oldWidget, const std::vector<sf::String>& newWidgetNames);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Removes a single widget that was added to the container.
         ///
@@ -345,6 +376,51 @@ namespace tgui
         void moveWidgetToBack(Widget *const widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Divides the container in a grid of cells to find the widget below the mouse faster.
+        ///
+        /// \param cellSize  Width and height of a single cell
+        ///
+        /// Without this index, every mouse event checks all widgets in the container. With the index, only the widgets that
+        /// are located in the same cell as the mouse are checked. This is only useful for containers with a lot of widgets.
+        ///
+        /// The index is updated when widgets are added, removed or reordered. Widgets that were moved or resized are noticed
+        /// when the container draws its widgets.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableSpatialIndex(float cellSize = 128);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Stops using a grid of cells to find the widget below the mouse.
+        ///
+        /// \see enableSpatialIndex
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disableSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws the widgets inside the container on a texture and keeps drawing that texture until one of them changes.
+        ///
+        /// This is useful for panels and child windows with a lot of widgets that rarely change: moving the container around
+        /// only requires drawing a single image instead of all its widgets.
+        ///
+        /// The texture has the size of the container, so the widgets will look blurry when the view is zoomed in.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableRenderCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws the widgets inside the container directly again (default).
+        ///
+        /// \see enableRenderCache
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disableRenderCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the transparency of the widget.
         ///
@@ -425,6 +501,61 @@ namespace tgui
         bool saveWidgetsToFile(const std::string& filename);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Save the widgets to a binary file.
+        ///
+        /// The file contains the same widgets and properties as the file created by saveWidgetsToFile, but every string is
+        /// only stored once, in a table at the start of the file. The widget types, names, property names and values are
+        /// stored as indices into that table, so each widget type is only looked up once while loading.
+        /// The loadWidgetsFromFile function recognizes these files and loads them without having to parse any text.
+        ///
+        /// Binary files can't be edited by hand, so you should keep the text file and convert it when your form changes.
+        ///
+        /// \param filename  Filename of the widget file that is to be created
+        ///
+        /// \return
+        ///        - true on success
+        ///        - false when the file couldn't be created
+        ///        - false when one of the properties couldn't be stored
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveWidgetsToBinaryFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes it possible to load and save a custom widget type in widget files.
+        ///
+        /// \param typeName  The name in front of the widget in the widget file (e.g. "Button"), case-insensitive
+        /// \param type      The typeid of the widget class, used to find the name of the widget when saving it
+        /// \param factory   Function that creates the widget, adds it to the given container with the given name and returns it
+        ///
+        /// The properties of the widget are saved with getPropertyList and getProperty, and loaded again with setProperty.
+        /// Registering a name that already exists replaces the widget type that was registered under that name.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void registerWidgetType(const std::string& typeName, const std::type_info& type, const WidgetFactory& factory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes it possible to load and save a custom widget type in widget files.
+        ///
+        /// \param typeName  The name in front of the widget in the widget file (e.g. "Button"), case-insensitive
+        ///
+        /// The widget class needs a Ptr typedef to a SharedWidgetPtr, just like the widgets from tgui.
+        ///
+        /// Usage example:
+        /// \code
+        /// tgui::Container::registerWidgetType<MyWidget>("MyWidget");
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename T>
+        static void registerWidgetType(const std::string& typeName)
+        {
+            registerWidgetType(typeName, typeid(T), [](Container& container, const sf::String& widgetName) { return Widget::Ptr(typename T::Ptr(container, widgetName)); });
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // This function is used internally by child widget to alert there parent about a callback.
@@ -499,6 +630,12 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the shortest time until one of the widgets in the container has to be updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When this function is called then all the widgets receive the event (if there are widgets).
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -534,12 +671,152 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the visible widgets on the target, without using the render cache.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets on the render cache again when they changed. Returns false when the texture couldn't be created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRenderCache() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widget in the given slot to the name and slot lookup tables, and to the updated widgets when needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void indexWidget(unsigned int slot);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts between a slot in m_Widgets and the id under which the widget is stored in the lookup tables.
+        // The ids don't change when widgets are removed, they are only given out again when the lists are compacted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getWidgetSlot(int indexedSlot) const;
+        int getIndexedSlot(unsigned int slot) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget in the given slot from the lookup tables and leaves the slot empty (a null pointer without a name),
+        // so that the widgets behind it keep their slot. Only empty slots at the end of the lists are removed immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseWidgetSlot(unsigned int slot, int indexedSlot);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widget to or removes it from the list of widgets that are updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetNeedsUpdates(Widget* widget, bool needsUpdates);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget with the given id from the widgets that can be found with the name. When another widget has the
+        // same name then the name will point to that widget instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unindexWidgetName(const sf::String& name, int indexedSlot);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the empty slots from the lists and recreates the lookup tables.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void compactWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area in which a widget could react on the mouse. It is a bit larger than the widget itself, because the
+        // borders of some widgets lie outside the rectangle starting at their position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getWidgetArea(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Puts all widgets in the cells of the spatial index again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates which cells of the spatial index are covered by the area that was stored for the widget in the given slot.
+        // Returns false when the widget isn't stored in the cells but has to be checked every time instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getSpatialIndexCells(unsigned int slot, int& left, int& top, int& right, int& bottom) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Puts a single widget in the spatial index or takes it out again. Nothing happens when the index is going to be
+        // rebuilt anyway. A widget has to be taken out before it leaves its slot.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToSpatialIndex(unsigned int slot);
+        void removeFromSpatialIndex(unsigned int slot);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that the widget may have been moved or resized, so that it is checked before the spatial index is used.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetChanged(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Compares the area of the changed widgets with the area they had in the spatial index. A widget whose area no longer
+        // matches is moved to the cells of its new area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void checkChangedWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads the widgets from a file created by saveWidgetsToBinaryFile. The signature was already read from the file.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadWidgetsFromBinaryFile(std::ifstream& file);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the widgets stored in the binary data, starting at the given position, and adds them to this container.
+        // The factories contain the widget type for every string that was already used as type name.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadBinaryWidgets(const std::vector<char>& buffer, std::size_t& pos, const std::vector<std::string>& strings,
+                               std::vector<const WidgetFactory*>& factories);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
+        struct WidgetNameHash
+        {
+            std::size_t operator()(const sf::String& name) const;
+        };
+
         std::vector<Widget::Ptr> m_Widgets;
         std::vector<sf::String>  m_ObjName;
 
+        // The widgets that currently need their update function to be called (this includes containers in which such a
+        // widget is placed), so that update doesn't have to visit all widgets every frame.
+        std::vector<Widget*> m_UpdatedWidgets;
+
+        // Lookup tables to find the slot of a widget in the above vectors without having to search through them.
+        // A name points to the sorted ids of the widgets with that name, widgets without a name are not stored in the name table.
+        std::unordered_map<sf::String, std::vector<int>, WidgetNameHash> m_WidgetNameIndex;
+        std::unordered_map<const Widget*, int>                           m_WidgetSlots;
+
+        // Removed widgets leave an empty slot (a null pointer) in the above vectors, so that the ids in the lookup tables stay
+        // valid. The id of a widget is its slot plus m_FirstIndexedSlot, which decreases when a widget is moved to the back.
+        // The empty slots are removed (and the ids reset) once there are many of them, or before the lists are handed out.
+        unsigned int m_EmptyWidgetSlots;
+        int          m_FirstIndexedSlot;
+
+        // Optional grid with the ids of the widgets that are (partially) inside each cell, sorted from back to front.
+        // Widgets that cover too many cells or whose area can't be predicted are always checked.
+        bool  m_SpatialIndexEnabled;
+        float m_SpatialIndexCellSize;
+        bool  m_SpatialIndexNeedsUpdate;
+        std::vector<sf::FloatRect> m_IndexedWidgetAreas;
+        std::vector<const Widget*> m_ChangedWidgets;
+        std::unordered_map<sf::Uint64, std::vector<int>> m_SpatialIndexCells;
+        std::vector<int> m_UnindexedWidgets;
+
+        // The widget that was below the mouse the last time that the spatial index was used
+        Widget* m_WidgetBelowMouse;
+
         // The id of the focused widget
         unsigned int m_FocusedWidget;
 
@@ -551,6 +828,19 @@ namespace tgui
         // A list that stores all functions that receive callbacks triggered by child widgets
         std::list< std::function<void(const Callback&)> > m_GlobalCallbackFunctions;
 
+        // Did the container or one of the widgets inside it change since the container was drawn for the last time?
+        mutable bool m_NeedsRedraw;
+
+        // Texture on which the widgets are drawn when the render cache is enabled
+        mutable bool              m_RenderCacheEnabled;
+        mutable sf::RenderTexture m_RenderCache;
+
+        // The clipping areas of the gui or the render cache while they are drawing this container
+        mutable ClipStack* m_ClipStack;
+
+
+        friend class Widget;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
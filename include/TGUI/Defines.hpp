@@ -166,12 +166,22 @@ namespace tgui
     extern TGUI_API std::string TGUI_ResourcePath;
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Finds the comma separated values in a string that looks like "(a, b, c)" without copying them.
+    // Every value starts at the pointer stored in the values array and ends at the next comma or closing bracket.
+    // The closing bracket has to be the last character of the string.
+    // Returns the amount of values that were found (at most maxValues), or 0 when the brackets are missing.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API unsigned int findBracketValues(const char* string, std::size_t length, const char* values[], unsigned int maxValues);
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \internal
     // Get a sf::Color from a string. The string must look like: "(r, g, b)" or "(r, g, b, a)".
     // When this function fails then it will return black.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TGUI_API sf::Color extractColor(std::string string);
+    TGUI_API sf::Color extractColor(const std::string& string);
 
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,21 +196,21 @@ namespace tgui
     /// \internal
     // Get a sf::Vector2f from a string. The string must look like: "(x, y)".
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TGUI_API bool extractVector2f(std::string string, sf::Vector2f& vector);
+    TGUI_API bool extractVector2f(const std::string& string, sf::Vector2f& vector);
 
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \internal
     // Get a sf::Vector2u from a string. The string must look like: "(x, y)".
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TGUI_API bool extractVector2u(std::string string, sf::Vector2u& vector);
+    TGUI_API bool extractVector2u(const std::string& string, sf::Vector2u& vector);
 
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \internal
     // Get a tgui::Borders from a string. The string must look like: "(left, top, right, bottom)".
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TGUI_API bool extractBorders(std::string string, Borders& borders);
+    TGUI_API bool extractBorders(const std::string& string, Borders& borders);
 
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,6 +221,13 @@ namespace tgui
     void encodeString(const std::string& origString, std::string& encodedString);
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Same as encodeString, but the encoded string is added to the end of the output string instead of replacing it.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void appendEncodedString(const std::string& origString, std::string& output);
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \internal
     // Converts an encoded string back into the original string.
@@ -225,6 +242,13 @@ namespace tgui
     TGUI_API void encodeList(const std::vector<sf::String>& list, std::string& encodedString);
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Same as encodeList, but the encoded list is added to the end of the output string instead of replacing it.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void appendEncodedList(const std::vector<sf::String>& list, std::string& output);
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \internal
     // Turns a list of strings into a string. Use the decodeList function to get the list back.
@@ -27,6 +27,7 @@
 
 
 #include <TGUI/ClickableWidget.hpp>
+#include <TGUI/TextMetrics.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -454,6 +455,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void textEntered(sf::Uint32 Key);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetFocused();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -465,14 +471,14 @@ namespace tgui
         // This function is a (slow) way to set properties on the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool setProperty(std::string property, const std::string& value);
+        virtual bool setProperty(const std::string& property, const std::string& value);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // This function is a (slow) way to get properties of the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool getProperty(std::string property, std::string& value) const;
+        virtual bool getProperty(const std::string& property, std::string& value) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -501,6 +507,19 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the positions of the characters behind the given one. This has to be called every time the displayed
+        // text changes, the positions in front of the first changed character remain the same.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCharacterPositions(unsigned int firstChangedCharacter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of characters at the beginning of the displayed text that fit inside the given width.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findCharactersFittingInWidth(float width) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -519,6 +538,12 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the selection point has to blink.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -593,6 +618,13 @@ namespace tgui
         sf::Text m_TextAfterSelection;
         sf::Text m_TextFull;
 
+        // The horizontal position of every character in the displayed text (the same as what m_TextFull.findCharacterPos
+        // would return). The last element contains the width of the whole text.
+        std::vector<float> m_CharacterPositions;
+
+        // Caches the widths of the characters in the font
+        TextMetrics m_TextMetrics;
+
         Texture  m_TextureNormal_L;
         Texture  m_TextureNormal_M;
         Texture  m_TextureNormal_R;
@@ -30,6 +30,7 @@
 #include <queue>
 
 #include <TGUI/Container.hpp>
+#include <TGUI/ClipStack.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -111,6 +112,56 @@ namespace tgui
         void draw(bool resetView = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the gui would look different than the last time that it was drawn.
+        ///
+        /// \return True when one of the widgets changed since the last call to draw
+        ///
+        /// The animated widgets (e.g. the blinking cursor of a focused edit box) only change when their time is updated,
+        /// so call updateTime first. When this function returns false and nothing else changed in your window, you can
+        /// skip the frame.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Updates the time of the animated widgets with the time passed since the previous update.
+        ///
+        /// The draw function already does this. You only have to call it yourself when you call needsRedraw before drawing.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTime();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how long it takes before one of the widgets will change by itself.
+        ///
+        /// \return Time until the next animation step, e.g. the selection point of a focused edit box blinking.
+        ///         When none of the widgets will change until an event occurs then Widget::NoDeadline is returned.
+        ///
+        /// Together with needsRedraw, this lets you sleep instead of drawing the same frame over and over again:
+        /// \code
+        /// while (window.isOpen())
+        /// {
+        ///     // Handle the events here
+        ///
+        ///     gui.updateTime();
+        ///     if (gui.needsRedraw())
+        ///     {
+        ///         window.clear();
+        ///         gui.draw();
+        ///         window.display();
+        ///     }
+        ///
+        ///     sf::sleep(std::min(gui.getTimeUntilUpdate(), sf::milliseconds(10)));
+        /// }
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Get the next callback from the callback queue.
         ///
@@ -286,6 +337,26 @@ namespace tgui
         Widget::Ptr copy(const Widget::Ptr& oldWidget, const sf::String& newWidgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes several copies of an existing widget at once.
+        ///
+        /// This gives the same result as calling copy for every name, but the lists of the container only grow once.
+        ///
+        /// \param oldWidget       A pointer to the old widget.
+        /// \param newWidgetNames  The names of the new widgets, one copy is made for every name
+        ///
+        /// \return Pointers to the new widgets, in the same order as the names
+        ///
+        /// Usage example:
+        /// \code
+        /// tgui::Button::Ptr row(gui, "RowTemplate");
+        /// std::vector<tgui::Widget::Ptr> rows = gui.copy(row, {"Row1", "Row2", "Row3"});
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<Widget::Ptr> copy(const Widget::Ptr& oldWidget, const std::vector<sf::String>& newWidgetNames);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Removes a single widget that was added to the container.
         ///
@@ -398,6 +469,45 @@ namespace tgui
         void moveWidgetToBack(Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Divides the window in a grid of cells to find the widget below the mouse faster.
+        ///
+        /// \param cellSize  Width and height of a single cell
+        ///
+        /// \see Container::enableSpatialIndex
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableSpatialIndex(float cellSize = 128);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Stops using a grid of cells to find the widget below the mouse.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disableSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Keeps the drawn widgets in a texture and only draws them again when one of them changed.
+        ///
+        /// As long as the widgets don't change, the draw function only has to draw this single texture on the window.
+        ///
+        /// Semi-transparent parts of the widgets will look a bit more transparent, because they are blended with the
+        /// empty texture first and only then with whatever you drew on the window behind the gui.
+        ///
+        /// \see needsRedraw
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableFrameCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws all widgets directly on the window every frame again (default).
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disableFrameCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Bind a function to the callbacks of all child widgets.
         ///
@@ -465,6 +575,26 @@ namespace tgui
         bool saveWidgetsToFile(const std::string& filename);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Save the widgets to a binary file.
+        ///
+        /// The file contains the same widgets and properties as the file created by saveWidgetsToFile, but the widget types
+        /// and property names are already resolved and every string is only stored once. The loadWidgetsFromFile function
+        /// recognizes these files and loads them without having to parse any text.
+        ///
+        /// Binary files can't be edited by hand, so you should keep the text file and convert it when your form changes.
+        ///
+        /// \param filename  Filename of the widget file that is to be created
+        ///
+        /// \return
+        ///        - true on success
+        ///        - false when the file couldn't be created
+        ///        - false when one of the properties couldn't be stored
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveWidgetsToBinaryFile(const std::string& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the internal clock to make animation possible. This function is called automatically by the draw function.
         // You will thus only need to call it yourself when you are drawing everything manually.
@@ -484,6 +614,15 @@ namespace tgui
         void addChildCallback(const Callback& callback);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets on the given target, which must be the active target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets(sf::RenderTarget& target);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -502,6 +641,14 @@ namespace tgui
         // Internal container to store all widgets
         GuiContainer m_Container;
 
+        // When the frame cache is enabled, the widgets are drawn on this texture with the stored view
+        bool              m_FrameCacheEnabled;
+        sf::RenderTexture m_FrameCache;
+        sf::View          m_FrameCacheView;
+
+        // The clipping areas of the widgets that are being drawn
+        ClipStack m_ClipStack;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
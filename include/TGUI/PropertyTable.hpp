@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROPERTY_TABLE_HPP
+#define TGUI_PROPERTY_TABLE_HPP
+
+
+#include <TGUI/Defines.hpp>
+
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include <initializer_list>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Maps the names of the properties of a widget type to a number, so that setProperty and getProperty can jump to the
+    // right property with a switch instead of comparing the name with every property that the widget has.
+    // The names are compared case-insensitively, without making a lowercase copy of the name that is looked up.
+    // A table only contains the properties of a single widget type, the properties of the base class are in its own table.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PropertyTable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // The name and type of a property, together with the number that is returned by find.
+        // A property with an empty type extends a property of the base class (e.g. Callback). It isn't added to the
+        // property list again, because the base class already lists it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Property
+        {
+            const char*  name;
+            const char*  type;
+            unsigned int id;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Creates the table from the properties in the order in which getPropertyList should list them.
+        // The ids of the properties may not be 0.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyTable(std::initializer_list<Property> properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the id of the property with the given name, or 0 when the widget type doesn't have this property.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int find(const std::string& name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Adds the names and types of the properties to the list, skipping the ones that extend a property of the base class.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToPropertyList(std::list< std::pair<std::string, std::string> >& list) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Hash and comparison functions that ignore the case of the characters
+        struct NameHash
+        {
+            std::size_t operator()(const std::string& name) const;
+        };
+
+        struct NameEqual
+        {
+            bool operator()(const std::string& left, const std::string& right) const;
+        };
+
+        std::vector<Property> m_Properties;
+        std::unordered_map<std::string, unsigned int, NameHash, NameEqual> m_Ids;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_TABLE_HPP
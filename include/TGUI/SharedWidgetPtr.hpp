@@ -70,6 +70,15 @@ namespace tgui
         template <class U>
         SharedWidgetPtr(const SharedWidgetPtr<U>& copy);
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SharedWidgetPtr(SharedWidgetPtr<T>&& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class U>
+        SharedWidgetPtr(SharedWidgetPtr<U>&& other);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         ~SharedWidgetPtr();
@@ -83,6 +92,15 @@ namespace tgui
         template <class U>
         SharedWidgetPtr<T>& operator=(const SharedWidgetPtr<U>& copy);
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SharedWidgetPtr<T>& operator=(SharedWidgetPtr<T>&& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class U>
+        SharedWidgetPtr<T>& operator=(SharedWidgetPtr<U>&& other);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         void init();
@@ -196,8 +214,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
+        // The reference count is stored inside the widget
         T* m_WidgetPtr;
-        unsigned int* m_RefCount;
+
+        template <class U>
+        friend class SharedWidgetPtr;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -48,8 +48,7 @@ namespace tgui
 
     template <class T>
     SharedWidgetPtr<T>::SharedWidgetPtr(std::nullptr_t) :
-    m_WidgetPtr(nullptr),
-    m_RefCount (nullptr)
+    m_WidgetPtr(nullptr)
     {
     }
 
@@ -76,40 +75,41 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
-    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<T>& copy)
+    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<T>& copy) :
+    m_WidgetPtr(copy.m_WidgetPtr)
     {
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = copy.get();
-
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+        if (m_WidgetPtr != nullptr)
+            m_WidgetPtr->m_RefCount += 1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
     template <class U>
-    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<U>& copy)
+    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<U>& copy) :
+    m_WidgetPtr(static_cast<T*>(copy.m_WidgetPtr))
     {
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = static_cast<T*>(copy.get());
+        if (m_WidgetPtr != nullptr)
+            m_WidgetPtr->m_RefCount += 1;
+    }
 
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    SharedWidgetPtr<T>::SharedWidgetPtr(SharedWidgetPtr<T>&& other) :
+    m_WidgetPtr(other.m_WidgetPtr)
+    {
+        other.m_WidgetPtr = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    template <class U>
+    SharedWidgetPtr<T>::SharedWidgetPtr(SharedWidgetPtr<U>&& other) :
+    m_WidgetPtr(static_cast<T*>(other.m_WidgetPtr))
+    {
+        other.m_WidgetPtr = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,23 +125,13 @@ namespace tgui
     template <class T>
     SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(const SharedWidgetPtr<T>& copy)
     {
-        if (this != &copy)
-        {
-            reset();
+        // The new widget is referenced before the old one is released, in case they are the same widget
+        T* widget = copy.m_WidgetPtr;
+        if (widget != nullptr)
+            widget->m_RefCount += 1;
 
-            if (copy.get() != nullptr)
-            {
-                m_WidgetPtr = copy.get();
-
-                m_RefCount = copy.getRefCount();
-                *m_RefCount += 1;
-            }
-            else
-            {
-                m_WidgetPtr = nullptr;
-                m_RefCount = nullptr;
-            }
-        }
+        reset();
+        m_WidgetPtr = widget;
 
         return *this;
     }
@@ -152,19 +142,28 @@ namespace tgui
     template <class U>
     SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(const SharedWidgetPtr<U>& copy)
     {
+        // The new widget is referenced before the old one is released, in case they are the same widget
+        T* widget = static_cast<T*>(copy.m_WidgetPtr);
+        if (widget != nullptr)
+            widget->m_RefCount += 1;
+
         reset();
+        m_WidgetPtr = widget;
 
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = static_cast<T*>(copy.get());
+        return *this;
+    }
 
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(SharedWidgetPtr<T>&& other)
+    {
+        if (this != &other)
         {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
+            reset();
+
+            m_WidgetPtr = other.m_WidgetPtr;
+            other.m_WidgetPtr = nullptr;
         }
 
         return *this;
@@ -173,14 +172,26 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
-    void SharedWidgetPtr<T>::init()
+    template <class U>
+    SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(SharedWidgetPtr<U>&& other)
     {
         reset();
 
-        m_RefCount = new unsigned int;
-        *m_RefCount = 1;
+        m_WidgetPtr = static_cast<T*>(other.m_WidgetPtr);
+        other.m_WidgetPtr = nullptr;
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    void SharedWidgetPtr<T>::init()
+    {
+        reset();
 
         m_WidgetPtr = new T();
+        m_WidgetPtr->m_RefCount = 1;
         m_WidgetPtr->m_Callback.widget = get();
     }
 
@@ -191,16 +202,11 @@ namespace tgui
     {
         if (m_WidgetPtr != nullptr)
         {
-            if (*m_RefCount == 1)
-            {
+            m_WidgetPtr->m_RefCount -= 1;
+            if (m_WidgetPtr->m_RefCount == 0)
                 delete m_WidgetPtr;
-                delete m_RefCount;
 
-                m_WidgetPtr = nullptr;
-                m_RefCount = nullptr;
-            }
-            else
-                *m_RefCount -= 1;
+            m_WidgetPtr = nullptr;
         }
     }
 
@@ -277,7 +283,10 @@ namespace tgui
     template <class T>
     unsigned int* SharedWidgetPtr<T>::getRefCount() const
     {
-        return m_RefCount;
+        if (m_WidgetPtr != nullptr)
+            return &m_WidgetPtr->m_RefCount;
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,10 +298,8 @@ namespace tgui
         {
             SharedWidgetPtr<T> pointer = nullptr;
 
-            pointer.m_RefCount = new unsigned int;
-            *pointer.m_RefCount = 1;
-
             pointer.m_WidgetPtr = m_WidgetPtr->clone();
+            pointer.m_WidgetPtr->m_RefCount = 1;
             pointer.m_WidgetPtr->m_Callback.widget = pointer.get();
             return pointer;
         }
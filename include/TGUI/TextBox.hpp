@@ -28,6 +28,8 @@
 
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/TextMetrics.hpp>
+#include <TGUI/TextDocument.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -495,6 +497,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void mouseNoLongerDown();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetFocused();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -506,14 +513,14 @@ namespace tgui
         // This function is a (slow) way to set properties on the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool setProperty(std::string property, const std::string& value);
+        virtual bool setProperty(const std::string& property, const std::string& value);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // This function is a (slow) way to get properties of the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool getProperty(std::string property, std::string& value) const;
+        virtual bool getProperty(const std::string& property, std::string& value) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -549,6 +556,78 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts characters in the text and rewraps the lines that are affected by it.
+        // When there is no scrollbar then the lines that no longer fit inside the text box are removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertCharacters(unsigned int position, const sf::String& characters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes characters from the text and rewraps the lines that are affected by it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseCharacters(unsigned int position, unsigned int count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the line breaks after 'removedCharacters' characters were replaced by 'insertedCharacters' characters at the
+        // given position. Only the lines starting from the changed one are rewrapped, until the line breaks are the same as
+        // they were before the change. This usually means that only a single paragraph is touched.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rewrapLines(unsigned int position, unsigned int removedCharacters, unsigned int insertedCharacters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the whole text into lines again. This has to be called when the available width or the font changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rewrapAllLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches where the line starting at the given character ends. The returned value is the first character of the
+        // next line. The lineBreakFound parameter is set to false when the end of the text was reached.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int wrapLine(unsigned int lineStart, float maxLineWidth, bool& lineBreakFound);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // When there is no scrollbar then the text may not have more lines than what fits inside the text box.
+        // This function removes the characters on the lines that don't fit.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeExcessLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that the lines may have before they get wrapped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaximumLineWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the line (starting from 0) on which the character is located.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findLine(unsigned int character) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the line on which the selection point is drawn. When the selection point is located where a line was
+        // wrapped then it is drawn behind the last character of the first line instead of in front of the next line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findSelectionPointLine() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the horizontal position of a character on the given line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float findCharacterPosX(unsigned int line, unsigned int character);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns in front of which character on the line the selection point should be placed when clicking on posX.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findCharacterOnLine(unsigned int line, float posX);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // To keep the drawing as fast as possible, all the calculation are done in front by this function.
         // It is called when the text changes, when scrolling, ...
@@ -558,9 +637,9 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called by updateDisplayedText and will split the text into five pieces so that the text can
-        // be easily drawn.
+        // be easily drawn. The parameters are the positions of the selection inside the displayed text.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectionTexts(float maxLineWidth);
+        void updateSelectionTexts(unsigned int selectionStart, unsigned int selectionEnd);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,6 +654,12 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the selection point has to blink.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -603,13 +688,20 @@ namespace tgui
         // The size of the text box
         sf::Vector2u m_Size;
 
-        // Some information about the text
-        sf::String   m_Text;
+        // Some information about the text. The displayed text only contains the lines that are (partially) visible.
+        TextDocument m_Text;
         sf::String   m_DisplayedText;
         unsigned int m_TextSize;
         unsigned int m_LineHeight;
         unsigned int m_Lines;
 
+        // The index of the first character of every line. The lines are created by newlines in the text and by wrapping
+        // the text when a line becomes too long. There is always at least one line, which starts at character 0.
+        std::vector<unsigned int> m_LineStarts;
+
+        // Caches the widths of the characters in the font
+        TextMetrics m_TextMetrics;
+
         // The maximum characters (0 by default, which means no limit)
         unsigned int m_MaxChars;
 
@@ -617,6 +709,9 @@ namespace tgui
         unsigned int m_TopLine;
         unsigned int m_VisibleLines;
 
+        // The line that is found at the beginning of the displayed text
+        unsigned int m_FirstDisplayedLine;
+
         // Information about the selection
         unsigned int m_SelChars;
         unsigned int m_SelStart;
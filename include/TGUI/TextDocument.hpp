@@ -0,0 +1,239 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_DOCUMENT_HPP
+#define TGUI_TEXT_DOCUMENT_HPP
+
+
+#include <TGUI/Defines.hpp>
+
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Stores a (possibly very long) text in small chunks, so that inserting or removing characters only has to move the
+    // characters inside one chunk instead of the whole text. The sizes of the chunks are kept in a binary indexed tree
+    // which allows finding the chunk that contains a character in logarithmic time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextDocument
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Iterates over the characters of the document. Moving to the next character takes constant time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API ConstIterator
+        {
+          public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// \brief Returns the character to which the iterator points.
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            sf::Uint32 operator*() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// \brief Moves the iterator to the next character.
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ConstIterator& operator++();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+          private:
+
+            ConstIterator(const TextDocument* document, unsigned int chunk, unsigned int offset);
+
+            const TextDocument* m_Document;
+            unsigned int        m_Chunk;
+            unsigned int        m_Offset;
+
+            friend class TextDocument;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextDocument();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Replaces the whole text of the document.
+        ///
+        /// \param text  The new text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setText(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the whole text of the document.
+        ///
+        /// \return A copy of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a part of the text of the document.
+        ///
+        /// \param position  The index of the first character to return
+        /// \param count     The amount of characters to return
+        ///
+        /// \return A copy of the requested characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getText(unsigned int position, unsigned int count) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Adds a part of the text to the end of a string.
+        ///
+        /// \param string    The string to which the characters should be appended
+        /// \param position  The index of the first character to append
+        /// \param count     The amount of characters to append
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendText(std::basic_string<sf::Uint32>& string, unsigned int position, unsigned int count) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of characters in the document.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the document contains no characters.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the character at the given position.
+        ///
+        /// This takes logarithmic time, use getIterator when reading many characters in a row.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Uint32 operator[](unsigned int position) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns an iterator that points to the character at the given position.
+        ///
+        /// The iterator is invalidated when the document is changed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ConstIterator getIterator(unsigned int position) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Inserts characters in the document.
+        ///
+        /// \param position  The index in front of which the characters will be inserted
+        /// \param text      The characters to insert
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(unsigned int position, const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Inserts a single character in the document.
+        ///
+        /// \param position   The index in front of which the character will be inserted
+        /// \param character  The character to insert
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(unsigned int position, sf::Uint32 character);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes characters from the document.
+        ///
+        /// \param position  The index of the first character to remove
+        /// \param count     The amount of characters to remove
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void erase(unsigned int position, unsigned int count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the chunk that contains the character at the given position and the offset of the character inside it.
+        // The position may be equal to the size of the document, in which case the last chunk is returned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findChunk(unsigned int position, unsigned int& offset) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the given chunk, which has become too big, with smaller chunks.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void splitChunk(unsigned int chunk);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the size of a chunk in the binary indexed tree.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateChunkSize(unsigned int chunk, int difference);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the binary indexed tree after chunks were added or removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildChunkTree();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        // The characters of the text. None of the chunks is empty.
+        std::vector< std::basic_string<sf::Uint32> > m_Chunks;
+
+        // The binary indexed tree that contains the sizes of the chunks (the first element is not used)
+        std::vector<unsigned int> m_ChunkTree;
+
+        unsigned int m_Size;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_DOCUMENT_HPP
@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_METRICS_HPP
+#define TGUI_TEXT_METRICS_HPP
+
+
+#include <TGUI/Defines.hpp>
+
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Measures text the same way as sf::Text::findCharacterPos does, but caches the advance of every glyph that it has seen
+    // so that measuring a character only costs an array lookup instead of a glyph lookup inside the font.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextMetrics
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextMetrics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the font and character size that are being measured.
+        ///
+        /// \param font           The font that is used to draw the text (may be nullptr)
+        /// \param characterSize  The character size of the text
+        ///
+        /// The cached advances are only thrown away when the font or character size is different from before.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFont(const sf::Font* font, unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Throws away all cached advances.
+        ///
+        /// This has to be called when the font may have changed without its address changing, e.g. when a new font was
+        /// assigned to the same sf::Font object.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the font that is being measured.
+        ///
+        /// \return The font that was passed to setFont
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Font* getFont() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how far the pen moves horizontally after drawing the character.
+        ///
+        /// \param character  The character to measure
+        ///
+        /// Spaces and tabs are measured like sf::Text does it, newlines have no width.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(sf::Uint32 character);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the distance that a character adds to the width of a line, including the kerning with the character
+        ///        in front of it.
+        ///
+        /// \param previous   The character in front of it, or 0 when the character is the first one on the line
+        /// \param character  The character to measure
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(sf::Uint32 previous, sf::Uint32 character);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        const sf::Font* m_Font;
+        unsigned int    m_CharacterSize;
+
+        // The advances of the ascii characters are stored in an array, all other characters are stored in the map.
+        // A negative value in the array means that the advance has not been looked up yet.
+        float m_AsciiAdvances[128];
+        std::map<sf::Uint32, float> m_Advances;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_METRICS_HPP
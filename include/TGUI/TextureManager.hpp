@@ -29,6 +29,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <list>
+#include <vector>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,15 +38,68 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // A large texture in which multiple images are packed
+    struct TextureAtlasPage
+    {
+        TextureAtlasPage() : entries(0) {}
+
+        // The images are only stored in the texture, there is no copy of the page in memory
+        sf::Texture texture;
+
+        // The parts of the page that are still available
+        std::vector<sf::IntRect> freeRects;
+
+        // The amount of images that are stored in the page
+        unsigned int entries;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct ImageMapData;
+
     struct TextureData
     {
-        TextureData() : image(nullptr) {}
+        TextureData() : image(nullptr), users(0), imageData(nullptr), atlasPage(nullptr) {}
+
+        const sf::Texture& getTexture() const
+        {
+            return (atlasPage != nullptr) ? atlasPage->texture : texture;
+        }
 
         sf::Image*    image;
         sf::Texture   texture;
         sf::IntRect   rect;
         std::string   filename;
         unsigned int  users;
+
+        // The loaded image to which this texture data belongs
+        ImageMapData* imageData;
+
+        // When the image is packed in an atlas then the texture of the atlas page is used instead of the texture above.
+        // The texture rect is the part of the used texture that contains the image.
+        TextureAtlasPage* atlasPage;
+        sf::IntRect       textureRect;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct TextureRectHash
+    {
+        std::size_t operator()(const sf::IntRect& rect) const
+        {
+            return ((((static_cast<std::size_t>(rect.left) * 31) + rect.top) * 31 + rect.width) * 31) + rect.height;
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct ImageMapData
+    {
+        sf::Image image;
+
+        // The parts of the image that are used, there can be two entries for the same part when one of them is stored in the
+        // atlas and the other one has its own texture
+        std::unordered_multimap<sf::IntRect, TextureData, TextureRectHash> data;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,6 +113,15 @@ namespace tgui
         sf::Vector2u getSize() const;
         bool isTransparentPixel(unsigned int x, unsigned int y);
 
+        // The texture rect is relative to the part of the texture that contains the image
+        void setTextureRect(const sf::IntRect& rect);
+        sf::IntRect getTextureRect() const;
+
+        // A texture that is repeated or smoothed can't share its texture with other images, so it is taken out of the atlas
+        void setRepeated(bool repeated);
+        void setSmooth(bool smooth);
+        bool isSmooth() const;
+
         operator const sf::Sprite&() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,6 +136,35 @@ namespace tgui
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextureManager();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Packs the images that are loaded from now on in a few large textures.
+        ///
+        /// \param maximumPageSize  The maximum width and height of a single texture in which the images are packed
+        ///
+        /// Widgets that use images from the same atlas texture can be drawn without switching textures. The atlas textures
+        /// start small and grow when more images are loaded. An image that is used repeated or smoothed (e.g. the middle
+        /// part of a split button) gets its own texture instead.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableAtlas(unsigned int maximumPageSize = 2048);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Gives every image that is loaded from now on its own texture again.
+        ///
+        /// Images that were already packed in the atlas remain there until they are removed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disableAtlas();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Loads a texture.
         ///
@@ -106,16 +199,43 @@ namespace tgui
         void removeTexture(Texture& textureToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Gives the texture its own copy of the image when it is stored in an atlas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool separateFromAtlas(Texture& texture);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
-        struct ImageMapData
-        {
-            sf::Image image;
-            std::list<TextureData> data;
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads a texture, but only puts it in the atlas when useAtlas is true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getTexture(const std::string& filename, Texture& texture, const sf::IntRect& rect, bool useAtlas);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the image of the texture data into one of the atlas pages. Returns false when the image can't be placed in
+        // the atlas (e.g. because it is too big).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addToAtlas(TextureData& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes the place of the texture data inside its atlas page available again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromAtlas(TextureData& data);
+
+        // The elements of an unordered map don't move when other elements are added or removed, so the texture data can
+        // keep a pointer to the image that it belongs to
+        std::unordered_map<std::string, ImageMapData> m_ImageMap;
+
+        bool         m_AtlasEnabled;
+        unsigned int m_MaximumAtlasPageSize;
 
-        std::map<std::string, ImageMapData> m_ImageMap;
+        // A list is used so that the pages don't move in memory when a page is added or removed
+        std::list<TextureAtlasPage> m_AtlasPages;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <TGUI/ConfigFile.hpp>
 #include <TGUI/Callback.hpp>
 #include <TGUI/Transformable.hpp>
+#include <TGUI/PropertyTable.hpp>
 #include <TGUI/SharedWidgetPtr.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +39,7 @@
 namespace tgui
 {
     class Container;
+    class ClipStack;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief The parent class for every widget.
@@ -72,6 +74,39 @@ namespace tgui
         virtual ~Widget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Allocates memory for a widget
+        ///
+        /// When TGUI is built with TGUI_USE_WIDGET_POOL, widgets are taken from free lists that are sorted by size.
+        /// Released widgets are put back in these lists, so creating and removing many widgets doesn't keep calling the heap.
+        ///
+        /// \param size  Size of the widget in bytes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void* operator new(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Releases the memory of a widget that was allocated with the operator new from this class
+        ///
+        /// \param pointer  Pointer to the released widget
+        /// \param size     Size of the widget in bytes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void operator delete(void* pointer, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the memory of the widget pool that isn't used by any widget to the heap
+        ///
+        /// The pool keeps the memory of released widgets to reuse it for new widgets. Call this function after removing a lot
+        /// of widgets (e.g. when leaving a screen of your program) to free the blocks in which no widget is left.
+        /// The function does nothing when TGUI was built without TGUI_USE_WIDGET_POOL.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releaseUnusedPoolMemory();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Overload of assignment operator
         ///
@@ -89,6 +124,23 @@ namespace tgui
         virtual Widget* clone() = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the position of the widget
+        ///
+        /// This function completely overwrites the previous position.
+        /// See the move function to apply an offset based on the previous position instead.
+        /// The default position of a transformable widget is (0, 0).
+        ///
+        /// \param x X coordinate of the new position
+        /// \param y Y coordinate of the new position
+        ///
+        /// \see move, getPosition
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setPosition(float x, float y);
+        using Transformable::setPosition;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Shows the widget.
         ///
@@ -260,6 +312,19 @@ namespace tgui
         virtual void moveToBack();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the gui that the widget has changed and that it has to be drawn again.
+        ///
+        /// The widgets call this function themselves when they are changed through their functions or by events.
+        /// You only need to call it when the widget changes in a way that tgui can't know about, e.g. when you
+        /// change a texture that the widget is using, or from the functions of your own widgets.
+        ///
+        /// \see Gui::needsRedraw
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markDirty();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the callback id of the widget.
         ///
@@ -288,11 +353,25 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called right after the elapsed time is changed.
-        // The elapsed time is only changed when the widget has set m_AnimatedWidget to true.
+        // The elapsed time is only changed while the widget has asked for updates with setNeedsUpdates.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how much time has to pass before the update function will change the widget (e.g. to show the next
+        // frame of an animation). Widgets that don't know this return sf::Time::Zero, so that they are updated every frame.
+        // NoDeadline is returned when the widget won't change by itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilUpdate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The time returned by getTimeUntilUpdate when the widget won't change until something else happens.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const sf::Time NoDeadline;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // The widgets use this function to send their callbacks to their parent and/or to a callback function.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,14 +451,14 @@ namespace tgui
         // This function is a (slow) way to set properties on the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool setProperty(std::string property, const std::string& value);
+        virtual bool setProperty(const std::string& property, const std::string& value);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // This function is a (slow) way to get properties of the widget, no matter what type it is.
         // When the requested property doesn't exist in the widget then the functions will return false.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual bool getProperty(std::string property, std::string& value) const;
+        virtual bool getProperty(const std::string& property, std::string& value) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -390,6 +469,38 @@ namespace tgui
         virtual std::list< std::pair<std::string, std::string> > getPropertyList() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the sprites with as few draw calls as possible, all sprites that use the same texture are drawn at once.
+        // Because the sprites are grouped by texture instead of being drawn in the given order, they may not overlap.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawSprites(sf::RenderTarget& target, sf::RenderStates states, std::initializer_list<const sf::Sprite*> sprites) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Widgets call this function when they start or stop needing the update function to be called (e.g. to let the
+        // selection point blink or to play an animation). Only the widgets that need it are updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setNeedsUpdates(bool needsUpdates);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the containers around the widget as changed, but not the widget itself when it is a container. A container
+        // only caches its widgets and not where it is drawn itself, so this is enough when only the position, visibility
+        // or transparency of the widget changed. The parent also checks the place of the widget in its spatial index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markParentDirty();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the stack of clipping areas of the gui or render cache that is drawing the widget. A null pointer is returned
+        // when the widget is drawn directly on a target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ClipStack* getClipStack() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -448,20 +559,35 @@ namespace tgui
         // Can the widget be focused?
         bool m_AllowFocus;
 
-        // Keep track of the elapsed time.
-        bool m_AnimatedWidget;
+        // Keep track of the elapsed time. The time is only updated while the widget needs updates.
+        bool m_NeedsUpdates;
         sf::Time m_AnimationTimeElapsed;
 
+        // Deprecated: call setNeedsUpdates instead. A widget that sets this to true before it is added to a container is
+        // updated every frame for as long as it stays inside the container.
+        bool m_AnimatedWidget;
+
         // This is set to true for widgets that have something to be dragged around (e.g. sliders and scrollbars)
         bool m_DraggableWidget;
 
         // This is set to true for widgets that store other widgets inside them
         bool m_ContainerWidget;
 
+        // The amount of SharedWidgetPtr objects that point to this widget. It is stored inside the widget so that creating
+        // a widget only requires a single allocation. A copy of a widget starts without any pointers to it.
+        unsigned int m_RefCount;
+
+        // Scratch space for drawSprites, kept between frames to avoid allocating memory every time the widget is drawn.
+        // It isn't copied along with the widget.
+        mutable std::vector<sf::Vertex> m_SpriteVertices;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container;
+
+        template <class T>
+        friend class SharedWidgetPtr;
     };
 
 
@@ -507,6 +633,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the four borders around an area of the given size, which starts at the origin, in a single draw call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawBorders(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Vector2f& size, const sf::Color& color) const;
+
+
         unsigned int m_LeftBorder;
         unsigned int m_TopBorder;
         unsigned int m_RightBorder;
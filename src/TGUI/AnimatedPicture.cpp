@@ -27,6 +27,33 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the animated picture
+    enum AnimatedPictureProperty
+    {
+        Property_Playing = 1,
+        Property_Looping,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getAnimatedPictureProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"Playing",  "bool", Property_Playing},
+            {"Looping",  "bool", Property_Looping},
+            {"Callback", "",     Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -39,7 +66,6 @@ namespace tgui
     m_Looping        (false)
     {
         m_Callback.widgetType = Type_AnimatedPicture;
-        m_AnimatedWidget = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +82,8 @@ namespace tgui
             m_Textures.push_back(Texture());
             TGUI_TextureManager.copyTexture(copy.m_Textures[i], m_Textures.back());
         }
+
+        setNeedsUpdates(m_Playing);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +118,8 @@ namespace tgui
             std::swap(m_CurrentFrame,    temp.m_CurrentFrame);
             std::swap(m_Playing,         temp.m_Playing);
             std::swap(m_Looping,         temp.m_Looping);
+
+            setNeedsUpdates(m_Playing);
         }
 
         return *this;
@@ -110,6 +140,8 @@ namespace tgui
         if (filename.empty())
             return false;
 
+        markDirty();
+
         Texture tempTexture;
 
         // Try to load the texture from the file
@@ -144,6 +176,8 @@ namespace tgui
     {
         m_Size.x = width;
         m_Size.y = height;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -164,8 +198,11 @@ namespace tgui
         if (m_Textures.empty())
             return;
 
+        markDirty();
+
         // Start playing
         m_Playing = true;
+        setNeedsUpdates(true);
 
         // Reset the elapsed time
         m_AnimationTimeElapsed = sf::Time();
@@ -176,6 +213,9 @@ namespace tgui
     void AnimatedPicture::pause()
     {
         m_Playing = false;
+        setNeedsUpdates(false);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,11 +223,14 @@ namespace tgui
     void AnimatedPicture::stop()
     {
         m_Playing = false;
+        setNeedsUpdates(false);
 
         if (m_Textures.empty())
             m_CurrentFrame = -1;
         else
             m_CurrentFrame = 0;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,11 +249,13 @@ namespace tgui
         {
             // Display the last frame
             m_CurrentFrame = m_Textures.size()-1;
+            markDirty();
             return false;
         }
 
         // The frame number isn't too high
         m_CurrentFrame = frame;
+        markDirty();
         return true;
     }
 
@@ -249,6 +294,8 @@ namespace tgui
         if (frame >= m_Textures.size())
             return false;
 
+        markDirty();
+
         // Remove the requested frame
         TGUI_TextureManager.removeTexture(m_Textures[frame]);
         m_Textures.erase(m_Textures.begin() + frame);
@@ -280,6 +327,8 @@ namespace tgui
         // Reset the animation
         stop();
         m_Loaded = false;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,6 +336,7 @@ namespace tgui
     void AnimatedPicture::setLooping(bool loop)
     {
         m_Looping = loop;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,43 +365,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool AnimatedPicture::setProperty(std::string property, const std::string& value)
+    bool AnimatedPicture::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "playing")
-        {
-            if ((value == "true") || (value == "True"))
-                m_Playing = true;
-            else if ((value == "false") || (value == "False"))
-                m_Playing = false;
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Playing' property.");
-        }
-        else if (property == "looping")
+        switch (getAnimatedPictureProperties().find(property))
         {
-            if ((value == "true") || (value == "True"))
-                m_Looping = true;
-            else if ((value == "false") || (value == "False"))
-                m_Looping = false;
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Looping' property.");
-        }
-        else if (property == "callback")
-        {
-            ClickableWidget::setProperty(property, value);
-
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+            case Property_Playing:
+            {
+                if ((value == "true") || (value == "True"))
+                    m_Playing = true;
+                else if ((value == "false") || (value == "False"))
+                    m_Playing = false;
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Playing' property.");
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                setNeedsUpdates(m_Playing);
+                break;
+            }
+            case Property_Looping:
             {
-                if ((*it == "AnimationFinished") || (*it == "animationfinished"))
-                    bindCallback(AnimationFinished);
+                if ((value == "true") || (value == "True"))
+                    m_Looping = true;
+                else if ((value == "false") || (value == "False"))
+                    m_Looping = false;
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Looping' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                ClickableWidget::setProperty(property, value);
+
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
+
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "AnimationFinished") || (*it == "animationfinished"))
+                        bindCallback(AnimationFinished);
+                }
+                break;
             }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -359,33 +415,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool AnimatedPicture::getProperty(std::string property, std::string& value) const
+    bool AnimatedPicture::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "playing")
-            value = m_Playing ? "true" : "false";
-        else if (property == "looping")
-            value = m_Looping ? "true" : "false";
-        else if (property == "callback")
+        switch (getAnimatedPictureProperties().find(property))
         {
-            std::string tempValue;
-            ClickableWidget::getProperty(property, tempValue);
+            case Property_Playing:
+                value = m_Playing ? "true" : "false";
+                break;
+            case Property_Looping:
+                value = m_Looping ? "true" : "false";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                ClickableWidget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(AnimationFinished) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(AnimationFinished).size() == 1) && (m_CallbackFunctions.at(AnimationFinished).front() == nullptr))
-                callbacks.push_back("AnimationFinished");
+                if ((m_CallbackFunctions.find(AnimationFinished) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(AnimationFinished).size() == 1) && (m_CallbackFunctions.at(AnimationFinished).front() == nullptr))
+                    callbacks.push_back("AnimationFinished");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -396,13 +456,22 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > AnimatedPicture::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("Playing", "bool"));
-        list.push_back(std::pair<std::string, std::string>("Looping", "bool"));
+        getAnimatedPictureProperties().addToPropertyList(list);
         return list;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void AnimatedPicture::initialize(Container *const parent)
+    {
+        m_Parent = parent;
+
+        // The animation may have been playing while the picture was not inside a container
+        setNeedsUpdates(m_Playing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void AnimatedPicture::update()
     {
         // Only continue when you are playing
@@ -417,6 +486,7 @@ namespace tgui
             {
                 // Decrease the elapsed time
                 m_AnimationTimeElapsed -= m_FrameDuration[m_CurrentFrame];
+                markDirty();
 
                 // Make the next frame visible
                 if (static_cast<unsigned int>(m_CurrentFrame + 1) < m_Textures.size())
@@ -431,6 +501,7 @@ namespace tgui
                         // Looping is disabled so stop the animation
                         m_Playing = false;
                         m_AnimationTimeElapsed = sf::Time();
+                        setNeedsUpdates(false);
                     }
 
                     // The animation has finished, send a callback if needed
@@ -449,6 +520,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time AnimatedPicture::getTimeUntilUpdate() const
+    {
+        if ((m_Playing == false) || (m_CurrentFrame < 0))
+            return NoDeadline;
+
+        // A frame without a duration remains visible
+        const sf::Time& frameDuration = m_FrameDuration[m_CurrentFrame];
+        if (frameDuration.asMicroseconds() <= 0)
+            return NoDeadline;
+
+        // The next frame is only shown once the elapsed time is larger than the duration of the current frame
+        if (m_AnimationTimeElapsed <= frameDuration)
+            return frameDuration - m_AnimationTimeElapsed + sf::microseconds(1);
+        else
+            return sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void AnimatedPicture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_Loaded)
@@ -30,6 +30,37 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the button
+    enum ButtonProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Text,
+        Property_TextColor,
+        Property_TextSize,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getButtonProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile", "string", Property_ConfigFile},
+            {"Text",       "string", Property_Text},
+            {"TextColor",  "color",  Property_TextColor},
+            {"TextSize",   "uint",   Property_TextSize},
+            {"Callback",   "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -135,6 +166,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // If the button was loaded before then remove the old textures first
         if (m_TextureNormal_L.data != nullptr)   TGUI_TextureManager.removeTexture(m_TextureNormal_L);
@@ -336,7 +368,7 @@ namespace tgui
                 setSize(static_cast<float>(m_TextureNormal_L.getSize().x + m_TextureNormal_M.getSize().x + m_TextureNormal_R.getSize().x),
                         static_cast<float>(m_TextureNormal_M.getSize().y));
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -350,19 +382,19 @@ namespace tgui
                 m_AllowFocus = true;
                 m_WidgetPhase |= WidgetPhase_Focused;
 
-                m_TextureFocused_M.data->texture.setRepeated(true);
+                m_TextureFocused_M.setRepeated(true);
             }
             if ((m_TextureHover_L.data != nullptr) && (m_TextureHover_M.data != nullptr) && (m_TextureHover_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureHover_M.data->texture.setRepeated(true);
+                m_TextureHover_M.setRepeated(true);
             }
             if ((m_TextureDown_L.data != nullptr) && (m_TextureDown_M.data != nullptr) && (m_TextureDown_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_MouseDown;
 
-                m_TextureDown_M.data->texture.setRepeated(true);
+                m_TextureDown_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -428,10 +460,10 @@ namespace tgui
                 m_TextureNormal_M.sprite.setPosition(x + (m_TextureNormal_L.getSize().x * m_TextureNormal_L.sprite.getScale().x), y);
                 m_TextureFocused_M.sprite.setPosition(x + (m_TextureFocused_L.getSize().x * m_TextureFocused_L.sprite.getScale().x), y);
 
-                m_TextureDown_R.sprite.setPosition(m_TextureDown_M.sprite.getPosition().x + (m_TextureDown_M.sprite.getTextureRect().width * scalingY), y);
-                m_TextureHover_R.sprite.setPosition(m_TextureHover_M.sprite.getPosition().x + (m_TextureHover_M.sprite.getTextureRect().width * scalingY), y);
-                m_TextureNormal_R.sprite.setPosition(m_TextureNormal_M.sprite.getPosition().x + (m_TextureNormal_M.sprite.getTextureRect().width * scalingY), y);
-                m_TextureFocused_R.sprite.setPosition(m_TextureFocused_M.sprite.getPosition().x + (m_TextureFocused_M.sprite.getTextureRect().width * scalingY), y);
+                m_TextureDown_R.sprite.setPosition(m_TextureDown_M.sprite.getPosition().x + (m_TextureDown_M.getTextureRect().width * scalingY), y);
+                m_TextureHover_R.sprite.setPosition(m_TextureHover_M.sprite.getPosition().x + (m_TextureHover_M.getTextureRect().width * scalingY), y);
+                m_TextureNormal_R.sprite.setPosition(m_TextureNormal_M.sprite.getPosition().x + (m_TextureNormal_M.getTextureRect().width * scalingY), y);
+                m_TextureFocused_R.sprite.setPosition(m_TextureFocused_M.sprite.getPosition().x + (m_TextureFocused_M.getTextureRect().width * scalingY), y);
             }
             else // The middle image isn't drawn
             {
@@ -452,6 +484,8 @@ namespace tgui
         // Set the position of the text
         m_Text.setPosition(std::floor(x + (m_Size.x - m_Text.getLocalBounds().width) * 0.5f -  m_Text.getLocalBounds().left),
                            std::floor(y + (m_Size.y - m_Text.getLocalBounds().height) * 0.5f -  m_Text.getLocalBounds().top));
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -462,6 +496,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the new size of the button
         m_Size.x = width;
         m_Size.y = height;
@@ -488,10 +524,10 @@ namespace tgui
             m_TextureNormal_L.sprite.setScale(scalingY, scalingY);
             m_TextureFocused_L.sprite.setScale(scalingY, scalingY);
 
-            m_TextureDown_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureDown_M.getSize().y));
-            m_TextureHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
-            m_TextureNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
-            m_TextureFocused_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
+            m_TextureDown_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureDown_M.getSize().y));
+            m_TextureHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
+            m_TextureNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
+            m_TextureFocused_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
 
             m_TextureDown_M.sprite.setScale(scalingY, scalingY);
             m_TextureHover_M.sprite.setScale(scalingY, scalingY);
@@ -523,6 +559,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the new text
         m_Text.setString(text);
         m_Callback.text = text;
@@ -566,6 +604,7 @@ namespace tgui
     void Button::setTextFont(const sf::Font& font)
     {
         m_Text.setFont(font);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -580,6 +619,7 @@ namespace tgui
     void Button::setTextColor(const sf::Color& color)
     {
         m_Text.setColor(color);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -598,6 +638,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text.getString());
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -671,43 +713,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Button::setProperty(std::string property, const std::string& value)
+    bool Button::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "text")
-        {
-            setText(value);
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "callback")
+        switch (getButtonProperties().find(property))
         {
-            ClickableWidget::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Text:
+            {
+                setText(value);
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_Callback:
+            {
+                ClickableWidget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "SpaceKeyPressed") || (*it == "spacekeypressed"))
-                    bindCallback(SpaceKeyPressed);
-                else if ((*it == "ReturnKeyPressed") || (*it == "returnkeypressed"))
-                    bindCallback(ReturnKeyPressed);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "SpaceKeyPressed") || (*it == "spacekeypressed"))
+                        bindCallback(SpaceKeyPressed);
+                    else if ((*it == "ReturnKeyPressed") || (*it == "returnkeypressed"))
+                        bindCallback(ReturnKeyPressed);
+                }
+                break;
             }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -715,39 +763,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Button::getProperty(std::string property, std::string& value) const
+    bool Button::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "text")
-            value = getText().toAnsiString();
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "callback")
+        switch (getButtonProperties().find(property))
         {
-            std::string tempValue;
-            ClickableWidget::getProperty(property, tempValue);
-
-            std::vector<sf::String> callbacks;
-
-            if ((m_CallbackFunctions.find(SpaceKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(SpaceKeyPressed).size() == 1) && (m_CallbackFunctions.at(SpaceKeyPressed).front() == nullptr))
-                callbacks.push_back("SpaceKeyPressed");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
-                callbacks.push_back("ReturnKeyPressed");
-
-            encodeList(callbacks, value);
-
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Text:
+                value = getText().toAnsiString();
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                ClickableWidget::getProperty(property, tempValue);
+
+                std::vector<sf::String> callbacks;
+
+                if ((m_CallbackFunctions.find(SpaceKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(SpaceKeyPressed).size() == 1) && (m_CallbackFunctions.at(SpaceKeyPressed).front() == nullptr))
+                    callbacks.push_back("SpaceKeyPressed");
+                if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+                    callbacks.push_back("ReturnKeyPressed");
+
+                encodeList(callbacks, value);
+
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -758,10 +812,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Button::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Text", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
+        getButtonProperties().addToPropertyList(list);
         return list;
     }
 
@@ -783,53 +834,39 @@ namespace tgui
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_L, states);
-                    target.draw(m_TextureDown_M, states);
-                    target.draw(m_TextureDown_R, states);
+                    drawSprites(target, states, {&m_TextureDown_L.sprite, &m_TextureDown_M.sprite, &m_TextureDown_R.sprite});
                 }
                 else if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    drawSprites(target, states, {&m_TextureHover_L.sprite, &m_TextureHover_M.sprite, &m_TextureHover_R.sprite});
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    drawSprites(target, states, {&m_TextureNormal_L.sprite, &m_TextureNormal_M.sprite, &m_TextureNormal_R.sprite});
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_L, states);
-                    target.draw(m_TextureDown_M, states);
-                    target.draw(m_TextureDown_R, states);
+                    drawSprites(target, states, {&m_TextureDown_L.sprite, &m_TextureDown_M.sprite, &m_TextureDown_R.sprite});
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    drawSprites(target, states, {&m_TextureNormal_L.sprite, &m_TextureNormal_M.sprite, &m_TextureNormal_R.sprite});
                 }
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    drawSprites(target, states, {&m_TextureHover_L.sprite, &m_TextureHover_M.sprite, &m_TextureHover_R.sprite});
                 }
             }
 
             // When the button is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_L, states);
-                target.draw(m_TextureFocused_M, states);
-                target.draw(m_TextureFocused_R, states);
+                drawSprites(target, states, {&m_TextureFocused_L.sprite, &m_TextureFocused_M.sprite, &m_TextureFocused_R.sprite});
             }
         }
         else // The images aren't split
@@ -84,6 +84,8 @@ namespace tgui
         Transformable::setPosition(x, y);
 
         m_sprite.setPosition(x, y);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,6 +97,8 @@ namespace tgui
 
         m_renderTexture.clear();
         m_renderTexture.display();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +134,7 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,13 +23,47 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <TGUI/Label.hpp>
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Panel.hpp>
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/ChatBox.hpp>
 
 #include <cmath>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Ids of the properties of the chat box
+    enum ChatBoxProperty
+    {
+        Property_ConfigFile = 1,
+        Property_TextSize,
+        Property_Borders,
+        Property_BackgroundColor,
+        Property_BorderColor,
+        Property_Lines
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getChatBoxProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",      "string",  Property_ConfigFile},
+            {"TextSize",        "uint",    Property_TextSize},
+            {"Borders",         "borders", Property_Borders},
+            {"BackgroundColor", "color",   Property_BackgroundColor},
+            {"BorderColor",     "color",   Property_BorderColor},
+            {"Lines",           "string",  Property_Lines}
+        };
+
+        return properties;
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -38,13 +72,15 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ChatBox::ChatBox() :
-        m_LineSpacing   (0),
-        m_TextSize      (16),
-        m_TextColor     (sf::Color::Black),
-        m_BorderColor   (sf::Color::Black),
-        m_MaxLines      (0),
-        m_FullTextHeight(0),
-        m_Scroll        (nullptr)
+        m_LineSpacing     (0),
+        m_TextSize        (16),
+        m_TextColor       (sf::Color::Black),
+        m_BorderColor     (sf::Color::Black),
+        m_MaxLines        (0),
+        m_FullTextHeight  (0),
+        m_FirstVisibleLine(0),
+        m_LastVisibleLine (0),
+        m_Scroll          (nullptr)
     {
         m_Callback.widgetType = Type_ChatBox;
         m_DraggableWidget = true;
@@ -68,10 +104,21 @@ namespace tgui
         m_TextColor       (copy.m_TextColor),
         m_BorderColor     (copy.m_BorderColor),
         m_MaxLines        (copy.m_MaxLines),
-        m_FullTextHeight  (copy.m_FullTextHeight)
+        m_FullTextHeight  (copy.m_FullTextHeight),
+        m_Lines           (copy.m_Lines),
+        m_FirstVisibleLine(copy.m_FirstVisibleLine),
+        m_LastVisibleLine (copy.m_LastVisibleLine),
+        m_TextMetrics     (copy.m_TextMetrics)
     {
         m_Panel = new Panel(*copy.m_Panel);
 
+        // The lines that use the default font have to use the font of the new panel
+        for (auto it = m_Lines.begin(); it != m_Lines.end(); ++it)
+        {
+            if (it->font == nullptr)
+                it->wrappedText.setFont(m_Panel->getGlobalFont());
+        }
+
         // If there is a scrollbar then copy it
         if (copy.m_Scroll != nullptr)
             m_Scroll = new Scrollbar(*copy.m_Scroll);
@@ -113,6 +160,10 @@ namespace tgui
             std::swap(m_BorderColor,      temp.m_BorderColor);
             std::swap(m_MaxLines,         temp.m_MaxLines);
             std::swap(m_FullTextHeight,   temp.m_FullTextHeight);
+            std::swap(m_Lines,            temp.m_Lines);
+            std::swap(m_FirstVisibleLine, temp.m_FirstVisibleLine);
+            std::swap(m_LastVisibleLine,  temp.m_LastVisibleLine);
+            std::swap(m_TextMetrics,      temp.m_TextMetrics);
             std::swap(m_Panel,            temp.m_Panel);
             std::swap(m_Scroll,           temp.m_Scroll);
         }
@@ -135,6 +186,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // If there already was a scrollbar then delete it now
         if (m_Scroll != nullptr)
@@ -238,6 +290,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -248,9 +302,6 @@ namespace tgui
         else
             width = TGUI_MAXIMUM(50 + m_Scroll->getSize().x, width);
 
-        // Remember the old height
-        float oldHeight = m_Panel->getSize().y;
-
         // Set the new size
         m_Panel->setSize(width, height);
 
@@ -261,13 +312,8 @@ namespace tgui
             m_Scroll->setSize(m_Scroll->getSize().x, m_Panel->getSize().y);
         }
 
-        // Find out how much the height has changed
-        float heightDiff = m_Panel->getSize().y - oldHeight;
-
-        // Reposition all labels in the chatbox
-        auto& labels = m_Panel->getWidgets();
-        for (auto it = labels.begin(); it != labels.end(); ++it)
-            (*it)->setPosition((*it)->getPosition().x, (*it)->getPosition().y + heightDiff);
+        // Other lines may have become visible
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,48 +356,32 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font)
     {
-        auto& widgets = m_Panel->getWidgets();
-
         // Remove the top line if you exceed the maximum
-        if ((m_MaxLines > 0) && (m_MaxLines < widgets.size() + 1))
+        if ((m_MaxLines > 0) && (m_MaxLines < m_Lines.size() + 1))
             removeLine(0);
 
-        Label::Ptr label(*m_Panel);
-        label->setTextColor(color);
-        label->setTextSize(textSize);
+        m_Lines.push_back(Line());
+        Line& line = m_Lines.back();
+        line.text = text;
+        line.font = font;
+        line.wrappedText.setColor(color);
+        line.wrappedText.setCharacterSize(textSize);
 
         if (font != nullptr)
-            label->setTextFont(*font);
-
-        Label::Ptr tempLine;
-        tempLine->setTextSize(textSize);
-        tempLine->setTextFont(*label->getTextFont());
-
-        float width = m_Panel->getSize().x;
-        if (m_Scroll)
-            width -= m_Scroll->getSize().x;
-
-        if (width < 0)
-            width = 0;
-
-        // Split the label over multiple lines if necessary
-        unsigned int pos = 0;
-        unsigned int size = 0;
-        while (pos + size < text.getSize())
-        {
-            tempLine->setText(text.toWideString().substr(pos, ++size));
+            line.wrappedText.setFont(*font);
+        else
+            line.wrappedText.setFont(m_Panel->getGlobalFont());
 
-            if (tempLine->getSize().x + 4.0f > width)
-            {
-                label->setText(label->getText() + text.toWideString().substr(pos, size - 1) + "\n");
+        // Split the line over multiple rows if necessary
+        wrapLine(line);
 
-                pos = pos + size - 1;
-                size = 0;
-            }
-        }
-        label->setText(label->getText() + tempLine->getText());
+        // The line is placed below the previous one
+        if (m_Lines.size() > 1)
+            line.top = m_Lines[m_Lines.size()-2].top + m_Lines[m_Lines.size()-2].height;
+        else
+            line.top = 0;
 
-        m_FullTextHeight += getLineSpacing(widgets.size()-1);
+        m_FullTextHeight += line.height;
 
         if (m_Scroll != nullptr)
         {
@@ -361,17 +391,19 @@ namespace tgui
                 m_Scroll->setValue(m_Scroll->getMaximum() - m_Scroll->getLowValue());
         }
 
-        // Reposition the labels
+        // Reposition the lines
         updateDisplayedText();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ChatBox::getLine(unsigned int lineIndex)
     {
-        if (lineIndex < m_Panel->getWidgets().size())
+        if (lineIndex < m_Lines.size())
         {
-            return tgui::Label::Ptr(m_Panel->getWidgets()[lineIndex])->getText();
+            return m_Lines[lineIndex].text;
         }
         else // Index too high
             return "";
@@ -381,16 +413,39 @@ namespace tgui
 
     bool ChatBox::removeLine(unsigned int lineIndex)
     {
-        if (lineIndex < m_Panel->getWidgets().size())
+        if (lineIndex < m_Lines.size())
         {
-            tgui::Label::Ptr label = m_Panel->getWidgets()[lineIndex];
-            m_FullTextHeight -= getLineSpacing(lineIndex);
-            m_Panel->remove(label);
+            if (lineIndex == 0)
+            {
+                // The tops are relative to the first line, so removing it doesn't require changing the other lines
+                m_FullTextHeight -= m_Lines.front().height;
+                m_Lines.pop_front();
+
+                if (m_Lines.empty())
+                    m_FullTextHeight = 0;
+
+                // The tops keep growing while lines are added at the bottom and removed at the top. Before they become
+                // too large to be stored precisely in a float, they are made relative to zero again.
+                else if (m_Lines.front().top > 1048576)
+                {
+                    const float firstTop = m_Lines.front().top;
+                    for (auto it = m_Lines.begin(); it != m_Lines.end(); ++it)
+                        it->top -= firstTop;
+                }
+            }
+            else
+            {
+                m_Lines.erase(m_Lines.begin() + lineIndex);
+
+                // The lines behind the removed one move up
+                recalculateLineTops(lineIndex);
+            }
 
             if (m_Scroll != nullptr)
                 m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
 
             updateDisplayedText();
+            markDirty();
             return true;
         }
         else // Index too high
@@ -401,7 +456,7 @@ namespace tgui
 
     void ChatBox::removeAllLines()
     {
-        m_Panel->removeAllWidgets();
+        m_Lines.clear();
 
         m_FullTextHeight = 0;
 
@@ -409,13 +464,15 @@ namespace tgui
             m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
 
         updateDisplayedText();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int ChatBox::getLineAmount()
     {
-        return m_Panel->getWidgets().size();
+        return m_Lines.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,19 +481,20 @@ namespace tgui
     {
         m_MaxLines = maxLines;
 
-        if ((m_MaxLines > 0) && (m_MaxLines < m_Panel->getWidgets().size()))
+        if ((m_MaxLines > 0) && (m_MaxLines < m_Lines.size()))
         {
-            while (m_MaxLines < m_Panel->getWidgets().size())
-            {
-                m_FullTextHeight -= getLineSpacing(0);
-                m_Panel->remove(m_Panel->getWidgets()[0]);
-            }
+            while (m_MaxLines < m_Lines.size())
+                m_Lines.pop_front();
+
+            recalculateLineTops(0);
 
             if (m_Scroll != nullptr)
                 m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
 
             updateDisplayedText();
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -445,9 +503,27 @@ namespace tgui
     {
         m_Panel->setGlobalFont(font);
 
-        auto& labels = m_Panel->getWidgets();
-        for (auto it = labels.begin(); it != labels.end(); ++it)
-            Label::Ptr(*it)->setTextFont(font);
+        // The font is copied into the panel, so its address stays the same while the glyphs may be different
+        m_TextMetrics.invalidate();
+
+        // The lines that use the default font have to be split again with the new font
+        for (auto it = m_Lines.begin(); it != m_Lines.end(); ++it)
+        {
+            if (it->font == nullptr)
+            {
+                it->wrappedText.setFont(m_Panel->getGlobalFont());
+                wrapLine(*it);
+            }
+        }
+
+        recalculateLineTops(0);
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
+
+        updateDisplayedText();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,6 +543,8 @@ namespace tgui
         // There is a minimum text size
         if (m_TextSize < 8)
             m_TextSize = 8;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -481,6 +559,7 @@ namespace tgui
     void ChatBox::setTextColor(const sf::Color& color)
     {
         m_TextColor = color;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -498,6 +577,8 @@ namespace tgui
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
         m_BottomBorder = bottomBorder;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -505,6 +586,7 @@ namespace tgui
     void ChatBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_Panel->setBackgroundColor(backgroundColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -512,6 +594,7 @@ namespace tgui
     void ChatBox::setBorderColor(const sf::Color& borderColor)
     {
         m_BorderColor = borderColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -534,7 +617,17 @@ namespace tgui
     {
         m_LineSpacing = lineSpacing;
 
+        for (auto it = m_Lines.begin(); it != m_Lines.end(); ++it)
+            it->height = getLineHeight(*it);
+
+        recalculateLineTops(0);
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
+
         updateDisplayedText();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,6 +638,8 @@ namespace tgui
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
 
+        markDirty();
+
         // If the scrollbar was already created then delete it first
         if (m_Scroll != nullptr)
             delete m_Scroll;
@@ -567,6 +662,7 @@ namespace tgui
             m_Scroll->setLowValue(static_cast<unsigned int>(m_Panel->getSize().y));
             m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
 
+            updateDisplayedText();
             return true;
         }
     }
@@ -578,6 +674,10 @@ namespace tgui
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
+
+        updateDisplayedText();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -725,6 +825,9 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            // The scrollbar has no parent, so a change in its hover state has to be reported here
+            bool scrollbarHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + m_Panel->getSize().x - m_Scroll->getSize().x, getPosition().y);
 
@@ -748,6 +851,9 @@ namespace tgui
                     m_Scroll->mouseMoved(x, y);
             }
 
+            if (m_Scroll->m_MouseHover != scrollbarHover)
+                markDirty();
+
             // Reset the position
             m_Scroll->setPosition(0, 0);
         }
@@ -809,72 +915,79 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ChatBox::setProperty(std::string property, const std::string& value)
+    bool ChatBox::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "borders")
-        {
-            Borders borders;
-            if (extractBorders(value, borders))
-                setBorders(borders.left, borders.top, borders.right, borders.bottom);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
-        }
-        else if (property == "backgroundcolor")
-        {
-            setBackgroundColor(extractColor(value));
-        }
-        else if (property == "bordercolor")
-        {
-            setBorderColor(extractColor(value));
-        }
-        else if (property == "lines")
+        switch (getChatBoxProperties().find(property))
         {
-            removeAllLines();
-
-            std::vector<sf::String> lines;
-            decodeList(value, lines);
-
-            for (auto it = lines.cbegin(); it != lines.cend(); ++it)
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_Borders:
+            {
+                Borders borders;
+                if (extractBorders(value, borders))
+                    setBorders(borders.left, borders.top, borders.right, borders.bottom);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
+                break;
+            }
+            case Property_BackgroundColor:
             {
-                std::string line = *it;
+                setBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_BorderColor:
+            {
+                setBorderColor(extractColor(value));
+                break;
+            }
+            case Property_Lines:
+            {
+                removeAllLines();
 
-                if ((line.length() >= 2) && (line[0] == '(' && line[line.length()-1] == ')'))
+                std::vector<sf::String> lines;
+                decodeList(value, lines);
+
+                for (auto it = lines.cbegin(); it != lines.cend(); ++it)
                 {
-                    line.erase(0, 1);
-                    line.erase(line.length()-1, 1);
+                    std::string line = *it;
 
-                    std::string::size_type openBracketPos = line.rfind('(');
-                    std::string::size_type closeBracketPos = line.rfind(')');
+                    if ((line.length() >= 2) && (line[0] == '(' && line[line.length()-1] == ')'))
+                    {
+                        line.erase(0, 1);
+                        line.erase(line.length()-1, 1);
 
-                    if ((openBracketPos == std::string::npos) || (closeBracketPos == std::string::npos) || (openBracketPos >= closeBracketPos))
-                        return false;
+                        std::string::size_type openBracketPos = line.rfind('(');
+                        std::string::size_type closeBracketPos = line.rfind(')');
 
-                    sf::Color color = extractColor(line.substr(openBracketPos, closeBracketPos - openBracketPos + 1));
+                        if ((openBracketPos == std::string::npos) || (closeBracketPos == std::string::npos) || (openBracketPos >= closeBracketPos))
+                            return false;
 
-                    std::string::size_type commaPos = line.rfind(',', openBracketPos);
-                    if (commaPos == std::string::npos)
-                        return false;
+                        sf::Color color = extractColor(line.substr(openBracketPos, closeBracketPos - openBracketPos + 1));
+
+                        std::string::size_type commaPos = line.rfind(',', openBracketPos);
+                        if (commaPos == std::string::npos)
+                            return false;
 
-                    line.erase(commaPos);
+                        line.erase(commaPos);
 
-                    addLine(line, color);
+                        addLine(line, color);
+                    }
+                    else
+                        return false;
                 }
-                else
-                    return false;
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -882,32 +995,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ChatBox::getProperty(std::string property, std::string& value) const
+    bool ChatBox::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "borders")
-            value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
-        else if (property == "backgroundcolor")
-            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
-        else if (property == "bordercolor")
-            value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
-        else if (property == "lines")
+        switch (getChatBoxProperties().find(property))
         {
-            std::vector<sf::String> lines;
-            std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
-
-            for (auto it = labels.cbegin(); it != labels.cend(); ++it)
-                lines.push_back("(" + Label::Ptr(*it)->getText() + "," + convertColorToString(Label::Ptr(*it)->getTextColor()) + ")");
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_Borders:
+                value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
+                break;
+            case Property_BackgroundColor:
+                value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+                break;
+            case Property_BorderColor:
+                value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
+                break;
+            case Property_Lines:
+            {
+                std::vector<sf::String> lines;
+                for (auto it = m_Lines.cbegin(); it != m_Lines.cend(); ++it)
+                    lines.push_back("(" + it->text + "," + convertColorToString(it->wrappedText.getColor()) + ")");
 
-            encodeList(lines, value);
+                encodeList(lines, value);
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -918,32 +1036,178 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > ChatBox::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Borders", "borders"));
-        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("BorderColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("Lines", "string"));
+        getChatBoxProperties().addToPropertyList(list);
         return list;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int ChatBox::getLineSpacing(unsigned int lineNumber)
+    void ChatBox::wrapLine(Line& line)
     {
-        assert(lineNumber < m_Panel->getWidgets().size());
+        float width = m_Panel->getSize().x;
+        if (m_Scroll)
+            width -= m_Scroll->getSize().x;
 
-        // If a line spacing was manually set then just return that one
-        if (m_LineSpacing > 0)
-            return m_LineSpacing;
+        if (width < 0)
+            width = 0;
+
+        // The width of a row may not come closer than 4 pixels to the side of the panel
+        width -= 4.0f;
+
+        m_TextMetrics.setFont(line.wrappedText.getFont(), line.wrappedText.getCharacterSize());
+
+        std::basic_string<sf::Uint32> wrappedText;
+        wrappedText.reserve(line.text.getSize() + 8);
+        line.rows = 1;
+
+        // Where the last space on the current row is located in the wrapped text and how wide the row was up to that space
+        std::size_t lastSpace = std::basic_string<sf::Uint32>::npos;
+        float rowWidthAtSpace = 0;
+
+        float rowWidth = 0;
+        sf::Uint32 previousChar = 0;
+        for (sf::String::ConstIterator it = line.text.begin(); it != line.text.end(); ++it)
+        {
+            sf::Uint32 character = *it;
+
+            if (character == '\n')
+            {
+                wrappedText += character;
+                ++line.rows;
+
+                lastSpace = std::basic_string<sf::Uint32>::npos;
+                rowWidth = 0;
+                previousChar = 0;
+                continue;
+            }
+
+            float advance = m_TextMetrics.getAdvance(previousChar, character);
+
+            // Check if the character still fits on the row (there is always at least one character on a row)
+            if ((rowWidth + advance > width) && (rowWidth > 0))
+            {
+                ++line.rows;
+
+                // A space that doesn't fit is replaced by the line break
+                if (character == ' ')
+                {
+                    wrappedText += '\n';
+
+                    lastSpace = std::basic_string<sf::Uint32>::npos;
+                    rowWidth = 0;
+                    previousChar = 0;
+                    continue;
+                }
+
+                if (lastSpace != std::basic_string<sf::Uint32>::npos)
+                {
+                    // Move the part of the word behind the last space to the next row
+                    wrappedText.insert(wrappedText.begin() + lastSpace + 1, '\n');
+                    rowWidth -= rowWidthAtSpace;
+
+                    if (lastSpace + 2 == wrappedText.size())
+                        previousChar = 0;
+                }
+                else // The word doesn't fit on the row by itself, so it has to be split
+                {
+                    wrappedText += '\n';
+                    rowWidth = 0;
+                    previousChar = 0;
+                }
+
+                lastSpace = std::basic_string<sf::Uint32>::npos;
+                advance = m_TextMetrics.getAdvance(previousChar, character);
+
+                // The remaining part of the word might still be too long to fit on the new row
+                if ((rowWidth + advance > width) && (rowWidth > 0))
+                {
+                    wrappedText += '\n';
+                    ++line.rows;
+
+                    rowWidth = 0;
+                    previousChar = 0;
+                    advance = m_TextMetrics.getAdvance(previousChar, character);
+                }
+            }
+
+            wrappedText += character;
+            rowWidth += advance;
+            previousChar = character;
+
+            if ((character == ' ') || (character == '\t'))
+            {
+                lastSpace = wrappedText.size() - 1;
+                rowWidthAtSpace = rowWidth;
+            }
+        }
+
+        line.wrappedText.setString(wrappedText);
+
+        // Make sure that the text is drawn at the top left of the line
+        sf::FloatRect bounds = line.wrappedText.getLocalBounds();
+        line.wrappedText.setOrigin(bounds.left, bounds.top);
+
+        line.height = getLineHeight(line);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ChatBox::getLineHeight(const Line& line) const
+    {
+        unsigned int textSize = line.wrappedText.getCharacterSize();
+        unsigned int fontLineSpacing = line.wrappedText.getFont()->getLineSpacing(textSize);
+
+        // The rows of a wrapped line are placed below each other by sf::Text
+        float rowsHeight = static_cast<float>((line.rows - 1) * fontLineSpacing);
 
-        auto line = tgui::Label::Ptr(m_Panel->getWidgets()[lineNumber]);
-        unsigned int lineSpacing = m_Panel->getGlobalFont().getLineSpacing(line->getTextSize());
+        // If a line spacing was manually set then just use that one
+        if (m_LineSpacing > 0)
+            return rowsHeight + m_LineSpacing;
 
-        if (lineSpacing > line->getTextSize())
-            return lineSpacing;
+        if (fontLineSpacing > textSize)
+            return rowsHeight + fontLineSpacing;
         else
-            return static_cast<unsigned int>(std::ceil(line->getSize().y * 13.5 / 10.0));
+            return std::ceil(line.wrappedText.getLocalBounds().height * 13.5f / 10.f);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::recalculateLineTops(unsigned int firstLine)
+    {
+        if (m_Lines.empty())
+        {
+            m_FullTextHeight = 0;
+            return;
+        }
+
+        // The positions are relative to the first line, so its top never has to change
+        for (unsigned int i = std::max(firstLine, 1u); i < m_Lines.size(); ++i)
+            m_Lines[i].top = m_Lines[i-1].top + m_Lines[i-1].height;
+
+        m_FullTextHeight = m_Lines.back().top + m_Lines.back().height - m_Lines.front().top;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ChatBox::findLineBelow(float position) const
+    {
+        if (m_Lines.empty())
+            return 0;
+
+        float firstTop = m_Lines.front().top;
+
+        unsigned int low = 0;
+        unsigned int high = m_Lines.size();
+        while (low < high)
+        {
+            unsigned int middle = low + (high - low) / 2;
+            if (m_Lines[middle].top - firstTop + m_Lines[middle].height > position)
+                high = middle;
+            else
+                low = middle + 1;
+        }
+
+        return low;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -958,62 +1222,57 @@ namespace tgui
 
     void ChatBox::updateDisplayedText()
     {
-        float position = 2.0f;
-        if (m_Scroll)
-            position -= static_cast<float>(m_Scroll->getValue());
+        m_FirstVisibleLine = 0;
+        m_LastVisibleLine = 0;
 
-        auto& labels = m_Panel->getWidgets();
-        for (unsigned int i = 0; i < labels.size(); ++i)
-        {
-            tgui::Label::Ptr label = labels[i];
-            label->setPosition(2.0f, position);
-
-            position += getLineSpacing(i);
-        }
+        if (m_Lines.empty())
+            return;
 
-        // Correct the position when there is no scrollbar
-        if ((m_Scroll == nullptr) && (!labels.empty()))
-        {
-            tgui::Label::Ptr label = labels.back();
-            if (position > m_Panel->getSize().y)
-            {
-                float diff = position - m_Panel->getSize().y;
-                for (auto it = labels.begin(); it != labels.end(); ++it)
-                    (*it)->setPosition((*it)->getPosition().x, (*it)->getPosition().y - diff);
-            }
-        }
+        // Find out how far the text is scrolled. Without a scrollbar the last lines are always visible.
+        float scrolled = 0;
+        if (m_Scroll != nullptr)
+            scrolled = static_cast<float>(m_Scroll->getValue());
+        else if (m_FullTextHeight + 2.0f > m_Panel->getSize().y)
+            scrolled = m_FullTextHeight + 2.0f - m_Panel->getSize().y;
+
+        // Only the lines that are inside the panel have to be positioned and drawn
+        m_FirstVisibleLine = findLineBelow(scrolled - 2.0f);
+        m_LastVisibleLine = findLineBelow(scrolled - 2.0f + m_Panel->getSize().y);
+        if (m_LastVisibleLine < m_Lines.size())
+            ++m_LastVisibleLine;
+
+        float firstTop = m_Lines.front().top;
+        for (unsigned int i = m_FirstVisibleLine; i < m_LastVisibleLine; ++i)
+            m_Lines[i].wrappedText.setPosition(2.0f, std::floor(2.0f + m_Lines[i].top - firstTop - scrolled + 0.5f));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        // Get the global position
+        sf::Vector2f topLeftPosition = states.transform.transformPoint(getPosition() - target.getView().getCenter() + (target.getView().getSize() / 2.f));
+        sf::Vector2f bottomRightPosition = states.transform.transformPoint(getPosition() + m_Panel->getSize() - target.getView().getCenter() + (target.getView().getSize() / 2.f));
+
         // Adjust the transformation
         states.transform *= getTransform();
 
         // Draw the panel
         target.draw(*m_Panel, states);
 
-        // Draw left border
-        sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), m_Panel->getSize().y + m_TopBorder));
-        border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
-        border.setFillColor(m_BorderColor);
-        target.draw(border, states);
-
-        // Draw top border
-        border.setSize(sf::Vector2f(m_Panel->getSize().x + m_RightBorder, static_cast<float>(m_TopBorder)));
-        border.setPosition(0, -static_cast<float>(m_TopBorder));
-        target.draw(border, states);
-
-        // Draw right border
-        border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), m_Panel->getSize().y + m_BottomBorder));
-        border.setPosition(m_Panel->getSize().x, 0);
-        target.draw(border, states);
-
-        // Draw bottom border
-        border.setSize(sf::Vector2f(m_Panel->getSize().x + m_LeftBorder, static_cast<float>(m_BottomBorder)));
-        border.setPosition(-static_cast<float>(m_LeftBorder), m_Panel->getSize().y);
-        target.draw(border, states);
+        // Set the clipping area
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
+
+        // Draw the visible lines
+        for (unsigned int i = m_FirstVisibleLine; i < m_LastVisibleLine; ++i)
+            target.draw(m_Lines[i].wrappedText, states);
+
+        // Reset the old clipping area
+        clipping.end();
+
+        // Draw the borders
+        drawBorders(target, states, m_Panel->getSize(), m_BorderColor);
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -54,6 +54,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // If the checkbox was loaded before then remove the old textures
         if (m_TextureUnchecked.data != nullptr) TGUI_TextureManager.removeTexture(m_TextureUnchecked);
@@ -176,6 +177,8 @@ namespace tgui
                 addCallback();
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -194,6 +197,8 @@ namespace tgui
                 addCallback();
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
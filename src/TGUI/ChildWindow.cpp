@@ -25,14 +25,54 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Button.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/ChildWindow.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the child window
+    enum ChildWindowProperty
+    {
+        Property_ConfigFile = 1,
+        Property_TitleBarHeight,
+        Property_BackgroundColor,
+        Property_Title,
+        Property_TitleColor,
+        Property_BorderColor,
+        Property_Borders,
+        Property_DistanceToSide,
+        Property_TitleAlignment,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getChildWindowProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",      "string",  Property_ConfigFile},
+            {"TitleBarHeight",  "uint",    Property_TitleBarHeight},
+            {"BackgroundColor", "color",   Property_BackgroundColor},
+            {"Title",           "string",  Property_Title},
+            {"TitleColor",      "color",   Property_TitleColor},
+            {"BorderColor",     "color",   Property_BorderColor},
+            {"Borders",         "borders", Property_Borders},
+            {"DistanceToSide",  "uint",    Property_DistanceToSide},
+            {"TitleAlignment",  "custom",  Property_TitleAlignment},
+            {"Callback",        "",        Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +197,7 @@ namespace tgui
 
         // Until the loading succeeds, the child window will be marked as unloaded
         m_Loaded = false;
+        markDirty();
 
         // Remove the textures when they were loaded before
         if (m_TextureTitleBar_L.data != nullptr) TGUI_TextureManager.removeTexture(m_TextureTitleBar_L);
@@ -323,7 +364,7 @@ namespace tgui
                 m_Loaded = true;
                 setSize(width, width * 3.0f / 4.0f);
 
-                m_TextureTitleBar_M.data->texture.setRepeated(true);
+                m_TextureTitleBar_M.setRepeated(true);
             }
             else
             {
@@ -386,7 +427,7 @@ namespace tgui
             m_TextureTitleBar_M.sprite.setScale(scalingY, scalingY);
             m_TextureTitleBar_R.sprite.setScale(scalingY, scalingY);
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
@@ -397,6 +438,8 @@ namespace tgui
         // If there is a background texture then resize it
         if (m_BackgroundTexture)
             m_BackgroundSprite.setScale(m_Size.x / m_BackgroundTexture->getSize().x, m_Size.y / m_BackgroundTexture->getSize().y);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +470,8 @@ namespace tgui
             m_BackgroundSprite.setTexture(*m_BackgroundTexture, true);
             m_BackgroundSprite.setScale(m_Size.x / m_BackgroundTexture->getSize().x, m_Size.y / m_BackgroundTexture->getSize().y);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,6 +489,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Remember the new title bar height
         m_TitleBarHeight = height;
 
@@ -467,7 +514,7 @@ namespace tgui
             m_TextureTitleBar_M.sprite.setScale(scalingY, scalingY);
             m_TextureTitleBar_R.sprite.setScale(scalingY, scalingY);
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
@@ -488,6 +535,7 @@ namespace tgui
     void ChildWindow::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -519,6 +567,7 @@ namespace tgui
     void ChildWindow::setTitle(const sf::String& title)
     {
         m_TitleText.setString(title);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -533,6 +582,7 @@ namespace tgui
     void ChildWindow::setTitleColor(const sf::Color& color)
     {
         m_TitleText.setColor(color);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -547,6 +597,7 @@ namespace tgui
     void ChildWindow::setBorderColor(const sf::Color& borderColor)
     {
         m_BorderColor = borderColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,13 +626,15 @@ namespace tgui
             if (m_Size.x + m_LeftBorder + m_RightBorder < minimumWidth)
                 m_Size.x = minimumWidth - m_LeftBorder - m_RightBorder;
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
             m_TextureTitleBar_M.sprite.setScale((m_Size.x + m_LeftBorder + m_RightBorder) / m_TextureTitleBar_M.getSize().x,
                                                 static_cast<float>(m_TitleBarHeight) / m_TextureTitleBar_M.getSize().y);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -589,6 +642,7 @@ namespace tgui
     void ChildWindow::setDistanceToSide(unsigned int distanceToSide)
     {
         m_DistanceToSide = distanceToSide;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -603,6 +657,7 @@ namespace tgui
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
         m_TitleAlignment = alignment;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -628,6 +683,8 @@ namespace tgui
         }
         else // Loading failed
             TGUI_OUTPUT("Failed to load \"" + filename + "\" as icon for the ChildWindow");
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -636,13 +693,16 @@ namespace tgui
     {
         if (m_IconTexture.data)
             TGUI_TextureManager.removeTexture(m_IconTexture);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChildWindow::destroy()
     {
-        m_Parent->remove(this);
+        if (m_Parent)
+            m_Parent->remove(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -650,6 +710,7 @@ namespace tgui
     void ChildWindow::keepInParent(bool enabled)
     {
         m_KeepInParent = enabled;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -663,7 +724,9 @@ namespace tgui
 
     void ChildWindow::setPosition(float x, float y)
     {
-        if (m_KeepInParent)
+        markParentDirty();
+
+        if (m_KeepInParent && m_Parent)
         {
             if (y < 0)
                 Transformable::setPosition(getPosition().x, 0);
@@ -695,7 +758,10 @@ namespace tgui
         if (getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_TitleBarHeight))).contains(x, y))
         {
             for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            {
+                if (m_Widgets[i] != nullptr)
+                    m_Widgets[i]->mouseNotOnWidget();
+            }
 
             return true;
         }
@@ -712,7 +778,10 @@ namespace tgui
 
                     // Tell the widgets inside the child window that the mouse is no longer on top of them
                     for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                        m_Widgets[i]->mouseNotOnWidget();
+                    {
+                        if (m_Widgets[i] != nullptr)
+                            m_Widgets[i]->mouseNotOnWidget();
+                    }
 
                     m_CloseButton->mouseNotOnWidget();
                     m_MouseHover = false;
@@ -822,7 +891,10 @@ namespace tgui
 
             // Tell the widgets that the mouse is no longer down
             for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNoLongerDown();
+            {
+                if (m_Widgets[i] != nullptr)
+                    m_Widgets[i]->mouseNoLongerDown();
+            }
 
             // Reset the position of the button
             m_CloseButton->setPosition(0, 0);
@@ -844,7 +916,10 @@ namespace tgui
             {
                 // Tell the widgets about that the mouse was released
                 for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                    m_Widgets[i]->mouseNoLongerDown();
+                {
+                    if (m_Widgets[i] != nullptr)
+                        m_Widgets[i]->mouseNoLongerDown();
+                }
 
                 // Don't send the event to the widgets
                 return;
@@ -886,9 +961,14 @@ namespace tgui
             m_CloseButton->setPosition(position.x + ((m_Size.x + m_LeftBorder + m_RightBorder - m_DistanceToSide - m_CloseButton->getSize().x)), position.y + ((m_TitleBarHeight / 2.f) - (m_CloseButton->getSize().x / 2.f)));
 
             // Send the hover event to the close button
+            bool closeButtonHover = m_CloseButton->m_MouseHover;
             if (m_CloseButton->mouseOnWidget(x, y))
                 m_CloseButton->mouseMoved(x, y);
 
+            // The close button is drawn with the title bar, the widgets inside the child window didn't change
+            if (m_CloseButton->m_MouseHover != closeButtonHover)
+                markParentDirty();
+
             // Reset the position of the button
             m_CloseButton->setPosition(0, 0);
             return;
@@ -897,7 +977,10 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
                 m_CloseButton->mouseNotOnWidget();
+                markParentDirty();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
@@ -928,76 +1011,87 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ChildWindow::setProperty(std::string property, const std::string& value)
+    bool ChildWindow::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "titlebarheight")
-        {
-            setTitleBarHeight(atoi(value.c_str()));
-        }
-        else if (property == "backgroundcolor")
-        {
-            setBackgroundColor(extractColor(value));
-        }
-        else if (property == "title")
-        {
-            setTitle(value);
-        }
-        else if (property == "titlecolor")
-        {
-            setTitleColor(extractColor(value));
-        }
-        else if (property == "bordercolor")
-        {
-            setBorderColor(extractColor(value));
-        }
-        else if (property == "borders")
-        {
-            Borders borders;
-            if (extractBorders(value, borders))
-                setBorders(borders.left, borders.top, borders.right, borders.bottom);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
-        }
-        else if (property == "distancetoside")
+        switch (getChildWindowProperties().find(property))
         {
-            setDistanceToSide(atoi(value.c_str()));
-        }
-        else if (property == "titlealignment")
-        {
-            if ((value == "left") || (value == "Left"))
-                setTitleAlignment(TitleAlignmentLeft);
-            else if ((value == "centered") || (value == "Centered"))
-                setTitleAlignment(TitleAlignmentCentered);
-            else if ((value == "right") || (value == "Right"))
-                setTitleAlignment(TitleAlignmentRight);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'TitleAlignment' property.");
-        }
-        else if (property == "callback")
-        {
-            Container::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_TitleBarHeight:
+            {
+                setTitleBarHeight(atoi(value.c_str()));
+                break;
+            }
+            case Property_BackgroundColor:
+            {
+                setBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_Title:
+            {
+                setTitle(value);
+                break;
+            }
+            case Property_TitleColor:
+            {
+                setTitleColor(extractColor(value));
+                break;
+            }
+            case Property_BorderColor:
+            {
+                setBorderColor(extractColor(value));
+                break;
+            }
+            case Property_Borders:
+            {
+                Borders borders;
+                if (extractBorders(value, borders))
+                    setBorders(borders.left, borders.top, borders.right, borders.bottom);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
+                break;
+            }
+            case Property_DistanceToSide:
+            {
+                setDistanceToSide(atoi(value.c_str()));
+                break;
+            }
+            case Property_TitleAlignment:
+            {
+                if ((value == "left") || (value == "Left"))
+                    setTitleAlignment(TitleAlignmentLeft);
+                else if ((value == "centered") || (value == "Centered"))
+                    setTitleAlignment(TitleAlignmentCentered);
+                else if ((value == "right") || (value == "Right"))
+                    setTitleAlignment(TitleAlignmentRight);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'TitleAlignment' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                Container::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "LeftMousePressed") || (*it == "leftmousepressed"))
-                    bindCallback(LeftMousePressed);
-                else if ((*it == "Closed") || (*it == "closed"))
-                    bindCallback(Closed);
-                else if ((*it == "Moved") || (*it == "moved"))
-                    bindCallback(Moved);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "LeftMousePressed") || (*it == "leftmousepressed"))
+                        bindCallback(LeftMousePressed);
+                    else if ((*it == "Closed") || (*it == "closed"))
+                        bindCallback(Closed);
+                    else if ((*it == "Moved") || (*it == "moved"))
+                        bindCallback(Moved);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Container::setProperty(property, value);
         }
-        else // The property didn't match
-            return Container::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1005,58 +1099,69 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ChildWindow::getProperty(std::string property, std::string& value) const
+    bool ChildWindow::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "titlebarheight")
-            value = to_string(getTitleBarHeight());
-        else if (property == "backgroundcolor")
-            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
-        else if (property == "title")
-            value = getTitle().toAnsiString();
-        else if (property == "titlecolor")
-            value = "(" + to_string(int(getTitleColor().r)) + "," + to_string(int(getTitleColor().g)) + "," + to_string(int(getTitleColor().b)) + "," + to_string(int(getTitleColor().a)) + ")";
-        else if (property == "bordercolor")
-            value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
-        else if (property == "borders")
-            value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
-        else if (property == "distancetoside")
-            value = to_string(getDistanceToSide());
-        else if (property == "titlealignment")
-        {
-            if (m_TitleAlignment == TitleAlignmentLeft)
-                value = "Left";
-            else if (m_TitleAlignment == TitleAlignmentCentered)
-                value = "Centered";
-            else if (m_TitleAlignment == TitleAlignmentRight)
-                value = "Right";
-        }
-        else if (property == "callback")
+        switch (getChildWindowProperties().find(property))
         {
-            std::string tempValue;
-            Container::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_TitleBarHeight:
+                value = to_string(getTitleBarHeight());
+                break;
+            case Property_BackgroundColor:
+                value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+                break;
+            case Property_Title:
+                value = getTitle().toAnsiString();
+                break;
+            case Property_TitleColor:
+                value = "(" + to_string(int(getTitleColor().r)) + "," + to_string(int(getTitleColor().g)) + "," + to_string(int(getTitleColor().b)) + "," + to_string(int(getTitleColor().a)) + ")";
+                break;
+            case Property_BorderColor:
+                value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
+                break;
+            case Property_Borders:
+                value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
+                break;
+            case Property_DistanceToSide:
+                value = to_string(getDistanceToSide());
+                break;
+            case Property_TitleAlignment:
+            {
+                if (m_TitleAlignment == TitleAlignmentLeft)
+                    value = "Left";
+                else if (m_TitleAlignment == TitleAlignmentCentered)
+                    value = "Centered";
+                else if (m_TitleAlignment == TitleAlignmentRight)
+                    value = "Right";
+                break;
+            }
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Container::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
-                callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(Closed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Closed).size() == 1) && (m_CallbackFunctions.at(Closed).front() == nullptr))
-                callbacks.push_back("Closed");
-            if ((m_CallbackFunctions.find(Moved) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Moved).size() == 1) && (m_CallbackFunctions.at(Moved).front() == nullptr))
-                callbacks.push_back("Moved");
+                if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+                    callbacks.push_back("LeftMousePressed");
+                if ((m_CallbackFunctions.find(Closed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Closed).size() == 1) && (m_CallbackFunctions.at(Closed).front() == nullptr))
+                    callbacks.push_back("Closed");
+                if ((m_CallbackFunctions.find(Moved) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Moved).size() == 1) && (m_CallbackFunctions.at(Moved).front() == nullptr))
+                    callbacks.push_back("Moved");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty() || tempValue.empty())
-                value += tempValue;
-            else
-                value += "," + tempValue;
+                if (value.empty() || tempValue.empty())
+                    value += tempValue;
+                else
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Container::getProperty(property, value);
         }
-        else // The property didn't match
-            return Container::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1067,15 +1172,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > ChildWindow::getPropertyList() const
     {
         auto list = Container::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("TitleBarHeight", "uint"));
-        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("Title", "string"));
-        list.push_back(std::pair<std::string, std::string>("TitleColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("BorderColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("Borders", "borders"));
-        list.push_back(std::pair<std::string, std::string>("DistanceToSide", "uint"));
-        list.push_back(std::pair<std::string, std::string>("TitleAlignment", "custom"));
+        getChildWindowProperties().addToPropertyList(list);
         return list;
     }
 
@@ -1086,6 +1183,9 @@ namespace tgui
         m_Parent = parent;
         setGlobalFont(m_Parent->getGlobalFont());
         m_TitleText.setFont(m_Parent->getGlobalFont());
+
+        // The new parent has to update this child window when one of its widgets needs updates
+        setNeedsUpdates(!m_UpdatedWidgets.empty());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1099,10 +1199,6 @@ namespace tgui
         // Get the current position
         sf::Vector2f position = getPosition();
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         sf::Vector2f viewPosition = (target.getView().getSize() / 2.f) - target.getView().getCenter();
 
         // Get the global position
@@ -1155,27 +1251,12 @@ namespace tgui
             states.transform.translate(m_IconTexture.getSize().x * m_IconTexture.sprite.getScale().x, (m_TitleBarHeight - (m_IconTexture.getSize().y * m_IconTexture.sprite.getScale().y)) / -2.f);
         }
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
         // Check if there is a title
         if (m_TitleText.getString().isEmpty() == false)
         {
-            // Calculate the clipping area
-            GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftTitleBarPosition.x * scaleViewX), scissor[0]);
-            GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftTitleBarPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-            GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightTitleBarPosition.x * scaleViewX), scissor[0] + scissor[2]);
-            GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightTitleBarPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-            // If the widget outside the window then don't draw anything
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            else if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
-
             // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            Clipping clipping;
+            clipping.begin(getClipStack(), target, topLeftTitleBarPosition, bottomRightTitleBarPosition);
 
             // Draw the text, depending on the alignment
             if (m_TitleAlignment == TitleAlignmentLeft)
@@ -1203,7 +1284,7 @@ namespace tgui
             }
 
             // Reset the old clipping area
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            clipping.end();
         }
 
         // Move the close button to the correct position
@@ -1250,26 +1331,15 @@ namespace tgui
         if (m_BackgroundTexture != nullptr)
             target.draw(m_BackgroundSprite, states);
 
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPanelPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPanelPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPanelPosition, bottomRightPanelPosition);
 
         // Draw the widgets in the child window
         drawWidgetContainer(&target, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        clipping.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,29 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the clickable widget
+    enum ClickableWidgetProperty
+    {
+        Property_Callback = 1
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getClickableWidgetProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"Callback", "", Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -80,6 +103,8 @@ namespace tgui
     {
         m_Size.x = width;
         m_Size.y = height;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -154,29 +179,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ClickableWidget::setProperty(std::string property, const std::string& value)
+    bool ClickableWidget::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "callback")
+        switch (getClickableWidgetProperties().find(property))
         {
-            Widget::setProperty(property, value);
-
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
-
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+            case Property_Callback:
             {
-                if ((*it == "LeftMousePressed") || (*it == "leftmousepressed"))
-                    bindCallback(LeftMousePressed);
-                else if ((*it == "LeftMouseReleased") || (*it == "leftmousereleased"))
-                    bindCallback(LeftMouseReleased);
-                else if ((*it == "LeftMouseClicked") || (*it == "leftmouseclicked"))
-                    bindCallback(LeftMouseClicked);
+                Widget::setProperty(property, value);
+
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
+
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "LeftMousePressed") || (*it == "leftmousepressed"))
+                        bindCallback(LeftMousePressed);
+                    else if ((*it == "LeftMouseReleased") || (*it == "leftmousereleased"))
+                        bindCallback(LeftMouseReleased);
+                    else if ((*it == "LeftMouseClicked") || (*it == "leftmouseclicked"))
+                        bindCallback(LeftMouseClicked);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -184,33 +211,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ClickableWidget::getProperty(std::string property, std::string& value) const
+    bool ClickableWidget::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "callback")
+        switch (getClickableWidgetProperties().find(property))
         {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
-                callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(LeftMouseReleased) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseReleased).size() == 1) && (m_CallbackFunctions.at(LeftMouseReleased).front() == nullptr))
-                callbacks.push_back("LeftMouseReleased");
-            if ((m_CallbackFunctions.find(LeftMouseClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseClicked).size() == 1) && (m_CallbackFunctions.at(LeftMouseClicked).front() == nullptr))
-                callbacks.push_back("LeftMouseClicked");
+                if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+                    callbacks.push_back("LeftMousePressed");
+                if ((m_CallbackFunctions.find(LeftMouseReleased) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseReleased).size() == 1) && (m_CallbackFunctions.at(LeftMouseReleased).front() == nullptr))
+                    callbacks.push_back("LeftMouseReleased");
+                if ((m_CallbackFunctions.find(LeftMouseClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseClicked).size() == 1) && (m_CallbackFunctions.at(LeftMouseClicked).front() == nullptr))
+                    callbacks.push_back("LeftMouseClicked");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty() || tempValue.empty())
-                value += tempValue;
-            else
-                value += "," + tempValue;
+                if (value.empty() || tempValue.empty())
+                    value += tempValue;
+                else
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
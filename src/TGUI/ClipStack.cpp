@@ -0,0 +1,195 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <SFML/OpenGL.hpp>
+
+#include <TGUI/ClipStack.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ClipStack::ClipStack() :
+    m_TargetHeight          (0),
+    m_PreviousScissorEnabled(false)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::begin(const sf::RenderTarget& target)
+    {
+        Area area = {0, 0, static_cast<int>(target.getSize().x), static_cast<int>(target.getSize().y)};
+        m_TargetHeight = target.getSize().y;
+
+        // The state is only read once, the widgets that are drawn afterwards don't have to ask OpenGL anymore
+        m_PreviousScissorEnabled = (glIsEnabled(GL_SCISSOR_TEST) == GL_TRUE);
+        if (m_PreviousScissorEnabled)
+        {
+            GLint scissor[4];
+            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+            std::copy(scissor, scissor + 4, m_PreviousScissor);
+
+            // Nothing may be drawn outside the area that was already set
+            area.left = TGUI_MAXIMUM(area.left, scissor[0]);
+            area.top = TGUI_MAXIMUM(area.top, static_cast<int>(m_TargetHeight) - scissor[1] - scissor[3]);
+            area.right = TGUI_MINIMUM(area.right, scissor[0] + scissor[2]);
+            area.bottom = TGUI_MINIMUM(area.bottom, static_cast<int>(m_TargetHeight) - scissor[1]);
+
+            if (area.right < area.left)
+                area.right = area.left;
+            if (area.bottom < area.top)
+                area.bottom = area.top;
+        }
+        else
+            glEnable(GL_SCISSOR_TEST);
+
+        m_Areas.clear();
+        m_Areas.push_back(area);
+        applyArea();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::end()
+    {
+        if (m_PreviousScissorEnabled)
+            glScissor(m_PreviousScissor[0], m_PreviousScissor[1], m_PreviousScissor[2], m_PreviousScissor[3]);
+        else
+            glDisable(GL_SCISSOR_TEST);
+
+        m_Areas.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ClipStack::push(const sf::RenderTarget& target, const sf::Vector2f& topLeft, const sf::Vector2f& bottomRight)
+    {
+        // Calculate the scale factor of the view
+        float scaleViewX = target.getSize().x / target.getView().getSize().x;
+        float scaleViewY = target.getSize().y / target.getView().getSize().y;
+
+        // The new area can't be bigger than the current one
+        const Area& current = m_Areas.back();
+        Area area;
+        area.left = TGUI_MAXIMUM(static_cast<int>(topLeft.x * scaleViewX), current.left);
+        area.top = TGUI_MAXIMUM(static_cast<int>(topLeft.y * scaleViewY), current.top);
+        area.right = TGUI_MINIMUM(static_cast<int>(bottomRight.x * scaleViewX), current.right);
+        area.bottom = TGUI_MINIMUM(static_cast<int>(bottomRight.y * scaleViewY), current.bottom);
+
+        // If the widget lies outside the current area then nothing can be drawn
+        if (area.right < area.left)
+            area.right = area.left;
+        if (area.bottom < area.top)
+            area.bottom = area.top;
+
+        m_Areas.push_back(area);
+        applyArea();
+
+        return (area.right > area.left) && (area.bottom > area.top);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::pop()
+    {
+        // The area of the whole target is never removed
+        if (m_Areas.size() <= 1)
+            return;
+
+        m_Areas.pop_back();
+        applyArea();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ClipStack::isVisible(const sf::RenderTarget& target, const sf::FloatRect& rect) const
+    {
+        // Calculate the scale factor of the view
+        float scaleViewX = target.getSize().x / target.getView().getSize().x;
+        float scaleViewY = target.getSize().y / target.getView().getSize().y;
+
+        sf::Vector2f viewPosition = (target.getView().getSize() / 2.f) - target.getView().getCenter();
+
+        const Area& current = m_Areas.back();
+        return ((rect.left + viewPosition.x) * scaleViewX < current.right)
+            && ((rect.left + rect.width + viewPosition.x) * scaleViewX > current.left)
+            && ((rect.top + viewPosition.y) * scaleViewY < current.bottom)
+            && ((rect.top + rect.height + viewPosition.y) * scaleViewY > current.top);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::applyArea() const
+    {
+        // OpenGL measures the area from the bottom of the target
+        const Area& area = m_Areas.back();
+        glScissor(area.left, static_cast<int>(m_TargetHeight) - area.bottom, area.right - area.left, area.bottom - area.top);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipping::Clipping() :
+    m_ClipStack(nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::begin(ClipStack* clipStack, const sf::RenderTarget& target, const sf::Vector2f& topLeft, const sf::Vector2f& bottomRight)
+    {
+        // Without a stack from the gui, the area is intersected with the scissor box that is currently set on the target
+        if (clipStack == nullptr)
+        {
+            m_OwnClipStack.begin(target);
+            clipStack = &m_OwnClipStack;
+        }
+
+        m_ClipStack = clipStack;
+        m_ClipStack->push(target, topLeft, bottomRight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::end()
+    {
+        if (m_ClipStack == nullptr)
+            return;
+
+        m_ClipStack->pop();
+        if (m_ClipStack == &m_OwnClipStack)
+            m_OwnClipStack.end();
+
+        m_ClipStack = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
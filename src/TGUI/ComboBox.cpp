@@ -25,8 +25,7 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/ListBox.hpp>
 #include <TGUI/Container.hpp>
@@ -36,6 +35,51 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the combo box
+    enum ComboBoxProperty
+    {
+        Property_ConfigFile = 1,
+        Property_ItemsToDisplay,
+        Property_BackgroundColor,
+        Property_TextColor,
+        Property_SelectedBackgroundColor,
+        Property_SelectedTextColor,
+        Property_BorderColor,
+        Property_Borders,
+        Property_MaximumItems,
+        Property_Items,
+        Property_SelectedItem,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getComboBoxProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",              "string",  Property_ConfigFile},
+            {"ItemsToDisplay",          "uint",    Property_ItemsToDisplay},
+            {"BackgroundColor",         "color",   Property_BackgroundColor},
+            {"TextColor",               "color",   Property_TextColor},
+            {"SelectedBackgroundColor", "color",   Property_SelectedBackgroundColor},
+            {"SelectedTextColor",       "color",   Property_SelectedTextColor},
+            {"BorderColor",             "color",   Property_BorderColor},
+            {"Borders",                 "borders", Property_Borders},
+            {"MaximumItems",            "uint",    Property_MaximumItems},
+            {"Items",                   "string",  Property_Items},
+            {"SelectedItem",            "int",     Property_SelectedItem},
+            {"Callback",                "",        Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,6 +168,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // Remove all textures if they were loaded before
         if (m_TextureArrowUpNormal.data != nullptr)    TGUI_TextureManager.removeTexture(m_TextureArrowUpNormal);
@@ -274,6 +319,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -314,6 +361,8 @@ namespace tgui
 
         if (m_NrOfItemsToDisplay < m_ListBox->m_Items.size())
             m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_NrOfItemsToDisplay * m_ListBox->getItemHeight()));
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -337,6 +386,7 @@ namespace tgui
     void ComboBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_ListBox->setBackgroundColor(backgroundColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -344,6 +394,7 @@ namespace tgui
     void ComboBox::setTextColor(const sf::Color& textColor)
     {
         m_ListBox->setTextColor(textColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -351,6 +402,7 @@ namespace tgui
     void ComboBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
         m_ListBox->setSelectedBackgroundColor(selectedBackgroundColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -358,6 +410,7 @@ namespace tgui
     void ComboBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
         m_ListBox->setSelectedTextColor(selectedTextColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -365,6 +418,7 @@ namespace tgui
     void ComboBox::setBorderColor(const sf::Color& borderColor)
     {
         m_ListBox->setBorderColor(borderColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -407,6 +461,7 @@ namespace tgui
     void ComboBox::setTextFont(const sf::Font& font)
     {
         m_ListBox->setTextFont(font);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +482,8 @@ namespace tgui
         m_BottomBorder = bottomBorder;
         m_ListBox->setBorders(m_LeftBorder, m_BottomBorder, m_RightBorder, m_BottomBorder);
 
+        markDirty();
+
         // Don't set the width and height when loading failed
         if (m_Loaded == false)
             return;
@@ -444,6 +501,8 @@ namespace tgui
         if (m_Loaded == false)
             return false;
 
+        markDirty();
+
         // Make room to add another item, until there are enough items
         if ((m_NrOfItemsToDisplay == 0) || (m_NrOfItemsToDisplay > m_ListBox->getItems().size()))
             m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight() * (m_ListBox->getItems().size() + 1)));
@@ -456,14 +515,18 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
-        return m_ListBox->setSelectedItem(itemName);
+        const bool selected = m_ListBox->setSelectedItem(itemName);
+        markDirty();
+        return selected;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::setSelectedItem(int index)
     {
-        return m_ListBox->setSelectedItem(index);
+        const bool selected = m_ListBox->setSelectedItem(index);
+        markDirty();
+        return selected;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -471,20 +534,29 @@ namespace tgui
     void ComboBox::deselectItem()
     {
         m_ListBox->deselectItem();
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::removeItem(unsigned int index)
     {
-        return m_ListBox->removeItem(index);
+        if (!m_ListBox->removeItem(index))
+            return false;
+
+        markDirty();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::removeItem(const sf::String& itemName)
     {
-        return m_ListBox->removeItem(itemName);
+        if (!m_ListBox->removeItem(itemName))
+            return false;
+
+        markDirty();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -492,6 +564,7 @@ namespace tgui
     void ComboBox::removeAllItems()
     {
         m_ListBox->removeAllItems();
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -533,7 +606,9 @@ namespace tgui
 
     bool ComboBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
-        return m_ListBox->setScrollbar(scrollbarConfigFileFilename);
+        const bool loaded = m_ListBox->setScrollbar(scrollbarConfigFileFilename);
+        markDirty();
+        return loaded;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,6 +616,7 @@ namespace tgui
     void ComboBox::removeScrollbar()
     {
         m_ListBox->removeScrollbar();
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,6 +624,7 @@ namespace tgui
     void ComboBox::setMaximumItems(unsigned int maximumItems)
     {
         m_ListBox->setMaximumItems(maximumItems);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -665,79 +742,92 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ComboBox::setProperty(std::string property, const std::string& value)
+    bool ComboBox::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "itemstodisplay")
-        {
-            setItemsToDisplay(atoi(value.c_str()));
-        }
-        else if (property == "backgroundcolor")
-        {
-            setBackgroundColor(extractColor(value));
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            setSelectedBackgroundColor(extractColor(value));
-        }
-        else if (property == "selectedtextcolor")
-        {
-            setSelectedTextColor(extractColor(value));
-        }
-        else if (property == "bordercolor")
+        switch (getComboBoxProperties().find(property))
         {
-            setBorderColor(extractColor(value));
-        }
-        else if (property == "borders")
-        {
-            Borders borders;
-            if (extractBorders(value, borders))
-                setBorders(borders.left, borders.top, borders.right, borders.bottom);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
-        }
-        else if (property == "maximumitems")
-        {
-            setMaximumItems(atoi(value.c_str()));
-        }
-        else if (property == "items")
-        {
-            removeAllItems();
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_ItemsToDisplay:
+            {
+                setItemsToDisplay(atoi(value.c_str()));
+                break;
+            }
+            case Property_BackgroundColor:
+            {
+                setBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedBackgroundColor:
+            {
+                setSelectedBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedTextColor:
+            {
+                setSelectedTextColor(extractColor(value));
+                break;
+            }
+            case Property_BorderColor:
+            {
+                setBorderColor(extractColor(value));
+                break;
+            }
+            case Property_Borders:
+            {
+                Borders borders;
+                if (extractBorders(value, borders))
+                    setBorders(borders.left, borders.top, borders.right, borders.bottom);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
+                break;
+            }
+            case Property_MaximumItems:
+            {
+                setMaximumItems(atoi(value.c_str()));
+                break;
+            }
+            case Property_Items:
+            {
+                removeAllItems();
 
-            std::vector<sf::String> items;
-            decodeList(value, items);
+                std::vector<sf::String> items;
+                decodeList(value, items);
 
-            for (auto it = items.cbegin(); it != items.cend(); ++it)
-                addItem(*it);
-        }
-        else if (property == "selecteditem")
-        {
-            setSelectedItem(atoi(value.c_str()));
-        }
-        else if (property == "callback")
-        {
-            Widget::setProperty(property, value);
+                for (auto it = items.cbegin(); it != items.cend(); ++it)
+                    addItem(*it);
+                break;
+            }
+            case Property_SelectedItem:
+            {
+                setSelectedItem(atoi(value.c_str()));
+                break;
+            }
+            case Property_Callback:
+            {
+                Widget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "ItemSelected") || (*it == "itemselected"))
-                    bindCallback(ItemSelected);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ItemSelected") || (*it == "itemselected"))
+                        bindCallback(ItemSelected);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -745,53 +835,66 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ComboBox::getProperty(std::string property, std::string& value) const
+    bool ComboBox::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "itemstodisplay")
-            value = to_string(getItemsToDisplay());
-        else if (property == "backgroundcolor")
-            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "selectedbackgroundcolor")
-            value = "(" + to_string(int(getSelectedBackgroundColor().r)) + "," + to_string(int(getSelectedBackgroundColor().g))
-                    + "," + to_string(int(getSelectedBackgroundColor().b)) + "," + to_string(int(getSelectedBackgroundColor().a)) + ")";
-        else if (property == "selectedtextcolor")
-            value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
-                    + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
-        else if (property == "bordercolor")
-            value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
-        else if (property == "borders")
-            value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
-        else if (property == "maximumitems")
-            value = to_string(getMaximumItems());
-        else if (property == "items")
-            encodeList(m_ListBox->getItems(), value);
-        else if (property == "selecteditem")
-            value = to_string(getSelectedItemIndex());
-        else if (property == "callback")
+        switch (getComboBoxProperties().find(property))
         {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_ItemsToDisplay:
+                value = to_string(getItemsToDisplay());
+                break;
+            case Property_BackgroundColor:
+                value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_SelectedBackgroundColor:
+                value = "(" + to_string(int(getSelectedBackgroundColor().r)) + "," + to_string(int(getSelectedBackgroundColor().g))
+                        + "," + to_string(int(getSelectedBackgroundColor().b)) + "," + to_string(int(getSelectedBackgroundColor().a)) + ")";
+                break;
+            case Property_SelectedTextColor:
+                value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
+                        + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
+                break;
+            case Property_BorderColor:
+                value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
+                break;
+            case Property_Borders:
+                value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
+                break;
+            case Property_MaximumItems:
+                value = to_string(getMaximumItems());
+                break;
+            case Property_Items:
+                encodeList(m_ListBox->getItems(), value);
+                break;
+            case Property_SelectedItem:
+                value = to_string(getSelectedItemIndex());
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ItemSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ItemSelected).size() == 1) && (m_CallbackFunctions.at(ItemSelected).front() == nullptr))
-                callbacks.push_back("ItemSelected");
+                if ((m_CallbackFunctions.find(ItemSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ItemSelected).size() == 1) && (m_CallbackFunctions.at(ItemSelected).front() == nullptr))
+                    callbacks.push_back("ItemSelected");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty() || tempValue.empty())
-                value += tempValue;
-            else
-                value += "," + tempValue;
+                if (value.empty() || tempValue.empty())
+                    value += tempValue;
+                else
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -802,17 +905,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > ComboBox::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("ItemsToDisplay", "uint"));
-        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedBackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedTextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("BorderColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("Borders", "borders"));
-        list.push_back(std::pair<std::string, std::string>("MaximumItems", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Items", "string"));
-        list.push_back(std::pair<std::string, std::string>("SelectedItem", "int"));
+        getComboBoxProperties().addToPropertyList(list);
         return list;
     }
 
@@ -905,10 +998,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         sf::Vector2f viewPosition = (target.getView().getSize() / 2.f) - target.getView().getCenter();
 
         // Get the global position
@@ -922,26 +1011,8 @@ namespace tgui
         // Remember the current transformation
         sf::Transform oldTransform = states.transform;
 
-        // Draw left border
-        sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_ListBox->getItemHeight() + m_TopBorder)));
-        border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
-        border.setFillColor(m_ListBox->m_BorderColor);
-        target.draw(border, states);
-
-        // Draw top border
-        border.setSize(sf::Vector2f(static_cast<float>(m_ListBox->getSize().x + m_RightBorder), static_cast<float>(m_TopBorder)));
-        border.setPosition(0, -static_cast<float>(m_TopBorder));
-        target.draw(border, states);
-
-        // Draw right border
-        border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_ListBox->getItemHeight() + m_BottomBorder)));
-        border.setPosition(static_cast<float>(m_ListBox->getSize().x), 0);
-        target.draw(border, states);
-
-        // Draw bottom border
-        border.setSize(sf::Vector2f(m_ListBox->getSize().x + m_LeftBorder, static_cast<float>(m_BottomBorder)));
-        border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_ListBox->getItemHeight()));
-        target.draw(border, states);
+        // Draw the borders
+        drawBorders(target, states, sf::Vector2f(m_ListBox->getSize().x, static_cast<float>(m_ListBox->getItemHeight())), m_ListBox->m_BorderColor);
 
         // Draw the combo box
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_ListBox->getSize().x),
@@ -955,24 +1026,9 @@ namespace tgui
         tempText.setCharacterSize(static_cast<unsigned int>(tempText.getCharacterSize() - tempText.getLocalBounds().top));
         tempText.setColor(m_ListBox->getTextColor());
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x  * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
 
         // Draw the selected item
         states.transform.translate(2, std::floor((static_cast<int>(m_ListBox->getItemHeight()) - tempText.getLocalBounds().height) / 2.0f -  tempText.getLocalBounds().top));
@@ -980,7 +1036,7 @@ namespace tgui
         target.draw(tempText, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        clipping.end();
 
         // Reset the transformations
         states.transform = oldTransform;
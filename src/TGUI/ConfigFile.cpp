@@ -27,6 +27,9 @@
 #include <cctype>
 #include <functional>
 
+#include <sys/types.h>
+#include <sys/stat.h>
+
 #include <TGUI/ConfigFile.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +38,17 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::unordered_map<std::string, ConfigFile::ParsedFile> ConfigFile::m_ParsedFiles;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ConfigFile::ConfigFile() :
+    m_ParsedFile(nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ConfigFile::~ConfigFile()
     {
         // If a file is still open then close it
@@ -47,107 +61,135 @@ namespace tgui
     bool ConfigFile::open(const std::string& filename)
     {
         // If a file is already open then close it
-        if (m_File.is_open())
-            m_File.close();
+        close();
+
+        struct stat fileInfo;
+        if (stat(filename.c_str(), &fileInfo) != 0)
+            return false;
+
+        // Reuse the parsed file when it wasn't changed since it was parsed
+        auto it = m_ParsedFiles.find(filename);
+        if ((it != m_ParsedFiles.end()) && (it->second.modificationTime == fileInfo.st_mtime))
+        {
+            m_ParsedFile = &it->second;
+            return true;
+        }
 
         // Open the file
         m_File.open(filename.c_str(), std::ifstream::in);
 
         // Check if the file was opened
-        if (m_File.is_open())
-            return true;
-        else
+        if (!m_File.is_open())
             return false;
+
+        ParsedFile& parsedFile = m_ParsedFiles[filename];
+        parsedFile.modificationTime = fileInfo.st_mtime;
+        parsedFile.sections.clear();
+        parseFile(parsedFile);
+
+        m_File.close();
+        m_ParsedFile = &parsedFile;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ConfigFile::read(std::string section, std::vector<std::string>& properties, std::vector<std::string>& values)
     {
-        bool error = false;
-        bool sectionFound = false;
-        unsigned int lineNumber = 0;
-
-        // Stop reading when we reach the end of the file
-        while (!m_File.eof())
+        // Output an error when the section wasn't found
+        std::unordered_map<std::string, Section>::const_iterator sectionIt;
+        if ((m_ParsedFile == nullptr) || ((sectionIt = m_ParsedFile->sections.find(toLower(section))) == m_ParsedFile->sections.end()))
         {
-            // Get the next line
-            std::string line;
-            std::getline(m_File, line);
-            lineNumber++;
-
-            std::string::const_iterator c = line.begin();
+            TGUI_OUTPUT("TGUI error: Section '" + section + "' was not found in the config file.");
+            return false;
+        }
 
-            // Check if we are reading a section
-            std::string sectionName;
-            if (isSection(line, c, sectionName))
-            {
-                // If we already found our section then this would be the next section
-                if (sectionFound)
-                    return !error;
+        for (auto it = sectionIt->second.errorLines.cbegin(); it != sectionIt->second.errorLines.cend(); ++it)
+            TGUI_OUTPUT("TGUI error: Failed to parse line " + to_string(*it) + ".");
 
-                // Convert the section names to lowercase in order to compare them
-                section = toLower(section);
-                sectionName = toLower(sectionName);
+        properties.insert(properties.end(), sectionIt->second.properties.begin(), sectionIt->second.properties.end());
+        values.insert(values.end(), sectionIt->second.values.begin(), sectionIt->second.values.end());
 
-                // If this is the section we were looking for then start reading the properties
-                if ((section + ":") == sectionName)
-                    sectionFound = true;
-            }
-            else // This isn't a section
-            {
-                // We are only interested in one section
-                if (!sectionFound)
-                    continue;
+        return sectionIt->second.errorLines.empty();
+    }
 
-                std::string property;
-                std::string value;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                if (!removeWhitespace(line, c))
-                    continue; // empty line
+    void ConfigFile::parseFile(ParsedFile& parsedFile)
+    {
+        // Read the whole file at once, the lines are parsed directly inside this buffer
+        std::vector<char> contents;
+        m_File.seekg(0, std::ifstream::end);
+        std::streamoff fileSize = m_File.tellg();
+        m_File.seekg(0, std::ifstream::beg);
+        if (fileSize > 0)
+        {
+            contents.resize(static_cast<std::size_t>(fileSize));
+            m_File.read(&contents[0], contents.size());
+            contents.resize(static_cast<std::size_t>(m_File.gcount()));
+        }
 
-                // Read the property in lowercase
-                property = readWord(line, c);
-                property = toLower(property);
+        // The lines in front of the first section and the lines of a section that occurs twice are skipped
+        Section ignoredSection;
+        Section* currentSection = &ignoredSection;
+        unsigned int lineNumber = 0;
 
-                if (!removeWhitespace(line, c))
-                {
-                    TGUI_OUTPUT("TGUI error: Failed to parse line " + to_string(lineNumber) + ".");
-                    error = true;
-                }
+        const char* fileEnd = contents.data() + contents.size();
+        const char* lineBegin = contents.data();
+        while (true)
+        {
+            lineNumber++;
+            const char* lineEnd = std::find(lineBegin, fileEnd, '\n');
 
-                // There has to be an assignment character
-                if (*c == '=')
+            // Skip empty lines
+            const char* c = skipWhitespace(lineBegin, lineEnd);
+            if (c != lineEnd)
+            {
+                const char* wordBegin = c;
+                while ((c != lineEnd) && !isWhitespace(*c))
                     ++c;
-                else
+
+                const char* wordEnd = c;
+                c = skipWhitespace(c, lineEnd);
+
+                // Check if we are reading a section
+                if ((c == lineEnd) && (*(wordEnd - 1) == ':'))
                 {
-                    TGUI_OUTPUT("TGUI error: Failed to parse line " + to_string(lineNumber) + ".");
-                    error = true;
+                    // The section name is stored in lowercase, without the colon behind it
+                    std::string sectionName = toLowerRange(wordBegin, wordEnd - 1);
+
+                    // When the same section occurs multiple times then only the first one is used
+                    if (parsedFile.sections.find(sectionName) == parsedFile.sections.end())
+                        currentSection = &parsedFile.sections[sectionName];
+                    else
+                        currentSection = &ignoredSection;
                 }
-
-                if (!removeWhitespace(line, c))
+                else // This isn't a section
                 {
-                    TGUI_OUTPUT("TGUI error: Failed to parse line " + to_string(lineNumber) + ".");
-                    error = true;
+                    if (c == lineEnd)
+                        currentSection->errorLines.push_back(lineNumber);
+
+                    // There has to be an assignment character
+                    if ((c != lineEnd) && (*c == '='))
+                        ++c;
+                    else
+                        currentSection->errorLines.push_back(lineNumber);
+
+                    c = skipWhitespace(c, lineEnd);
+                    if (c == lineEnd)
+                        currentSection->errorLines.push_back(lineNumber);
+
+                    // Read the property in lowercase
+                    currentSection->properties.push_back(toLowerRange(wordBegin, wordEnd));
+                    currentSection->values.push_back(std::string(c, lineEnd));
                 }
-
-                int pos = c - line.begin();
-                value = line.substr(pos, line.length() - pos);
-
-                properties.push_back(property);
-                values.push_back(value);
             }
-        }
 
-        // Output an error when the section wasn't found
-        if (!sectionFound)
-        {
-            TGUI_OUTPUT("TGUI error: Section '" + section + "' was not found in the config file.");
-            error = true;
-        }
+            if (lineEnd == fileEnd)
+                break;
 
-        // The end of the file was reached
-        return !error;
+            lineBegin = lineEnd + 1;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,50 +213,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ConfigFile::readIntRect(std::string value, sf::IntRect& rect) const
+    bool ConfigFile::readIntRect(const std::string& value, sf::IntRect& rect) const
     {
-        // Make sure that the line isn't empty
-        if (value.empty() == false)
-        {
-            // The first and last character have to be brackets
-            if ((value[0] == '(') && (value[value.length()-1] == ')'))
-            {
-                // Remove the brackets
-                value.erase(0, 1);
-                value.erase(value.length()-1);
+        return readIntRect(value.c_str(), value.length(), rect);
+    }
 
-                // Search for the first comma
-                std::string::size_type commaPos = value.find(',');
-                if (commaPos != std::string::npos)
-                {
-                    // Get the left value and delete this part of the string
-                    rect.left = atoi(value.substr(0, commaPos).c_str());
-                    value.erase(0, commaPos+1);
-
-                    // Search for the second comma
-                    commaPos = value.find(',');
-                    if (commaPos != std::string::npos)
-                    {
-                        // Get the top value and delete this part of the string
-                        rect.top = atoi(value.substr(0, commaPos).c_str());
-                        value.erase(0, commaPos+1);
-
-                        // Search for the third comma
-                        commaPos = value.find(',');
-                        if (commaPos != std::string::npos)
-                        {
-                            // Get the width value and delete this part of the string
-                            rect.width = atoi(value.substr(0, commaPos).c_str());
-                            value.erase(0, commaPos+1);
-
-                            // Get the height value
-                            rect.height = atoi(value.c_str());
-
-                            return true;
-                        }
-                    }
-                }
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ConfigFile::readIntRect(const char* value, std::size_t length, sf::IntRect& rect) const
+    {
+        const char* values[4];
+        if (findBracketValues(value, length, values, 4) == 4)
+        {
+            rect.left = atoi(values[0]);
+            rect.top = atoi(values[1]);
+            rect.width = atoi(values[2]);
+            rect.height = atoi(values[3]);
+            return true;
         }
 
         return false;
@@ -264,7 +279,7 @@ namespace tgui
         sf::IntRect rect;
         if (removeWhitespace(value, c))
         {
-            if (!readIntRect(value.substr(c - value.begin(), value.length() - (c - value.begin())), rect))
+            if (!readIntRect(&*c, value.end() - c, rect))
                 return false;
         }
 
@@ -279,6 +294,8 @@ namespace tgui
         // Close the file (if it is open)
         if (m_File.is_open())
             m_File.close();
+
+        m_ParsedFile = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -298,41 +315,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::string ConfigFile::readWord(const std::string& line, std::string::const_iterator& c) const
+    bool ConfigFile::isWhitespace(char c)
     {
-        std::string word;
-        while (c != line.end())
-        {
-            if ((*c != ' ') && (*c != '\t') && (*c != '\r'))
-            {
-                word.push_back(*c);
-                ++c;
-            }
-            else
-                return word;
-        }
-
-        return word;
+        return (c == ' ') || (c == '\t') || (c == '\r');
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ConfigFile::isSection(const std::string& line, std::string::const_iterator c, std::string& sectionName) const
+    const char* ConfigFile::skipWhitespace(const char* c, const char* end)
     {
-        if (!removeWhitespace(line, c))
-            return false;
+        while ((c != end) && isWhitespace(*c))
+            ++c;
 
-        sectionName = readWord(line, c);
+        return c;
+    }
 
-        removeWhitespace(line, c);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (c != line.end())
-            return false;
+    std::string ConfigFile::toLowerRange(const char* begin, const char* end)
+    {
+        std::string str(begin, end);
+        for (std::string::iterator i = str.begin(); i != str.end(); ++i)
+            *i = static_cast<char>(std::tolower(*i));
 
-        if (sectionName[sectionName.length()-1] == ':')
-            return true;
-        else
-            return false;
+        return str;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,20 +26,322 @@
 #include <stack>
 #include <cmath>
 #include <cassert>
+#include <algorithm>
+#include <fstream>
+#include <typeindex>
 
 #include <TGUI/TGUI.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Combines the column and row of a cell in the spatial index into a single key
+    sf::Uint64 getCellKey(int column, int row)
+    {
+        return (static_cast<sf::Uint64>(static_cast<sf::Uint32>(column)) << 32) | static_cast<sf::Uint32>(row);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The cells of the spatial index are kept sorted, so that the widgets in front are found first
+    void insertSorted(std::vector<int>& ids, int id)
+    {
+        ids.insert(std::upper_bound(ids.begin(), ids.end(), id), id);
+    }
+
+    void eraseSorted(std::vector<int>& ids, int id)
+    {
+        auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        if ((it != ids.end()) && (*it == id))
+            ids.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Removes the spaces and tabs from a line of a widget file and converts it to lowercase. Only the text between the
+    // quotes is kept as it is, except that escaped characters in it are decoded and the quotes themselves are removed.
+    // Returns false when the quotes in the line are wrong.
+    bool normalizeFormLine(std::string& line)
+    {
+        if (line.empty())
+            return true;
+
+        // Search for a quote
+        std::string::size_type quotePos1 = line.find('"');
+
+        // Check if the quote was found or not
+        if (quotePos1 == std::string::npos)
+        {
+            // Remove all spaces and tabs from the whole line
+            line.erase(std::remove(line.begin(), line.end(), ' '), line.end());
+            line.erase(std::remove(line.begin(), line.end(), '\t'), line.end());
+            line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+
+            // Convert the whole line to lowercase
+            line = tgui::toLower(line);
+        }
+        else // A quote was found
+        {
+            // Only remove spaces and tabs until the quote
+            line.erase(std::remove(line.begin(), line.begin() + quotePos1, ' '), line.begin() + quotePos1);
+            quotePos1 = line.find('"');
+            line.erase(std::remove(line.begin(), line.begin() + quotePos1, '\t'), line.begin() + quotePos1);
+            quotePos1 = line.find('"');
+
+            // Convert the part before the quote to lowercase
+            line = tgui::toLower(line.substr(0, quotePos1)) + line.substr(quotePos1);
+
+            // Search for a second quote
+            std::string::size_type quotePos2 = line.find('"', quotePos1 + 1);
+
+            // There must always be a second quote
+            if (quotePos2 != std::string::npos)
+            {
+                // Remove all spaces and tabs after the quote
+                line.erase(std::remove(line.begin() + quotePos2, line.end(), ' '), line.end());
+                line.erase(std::remove(line.begin() + quotePos2, line.end(), '\t'), line.end());
+                line.erase(std::remove(line.begin() + quotePos2, line.end(), '\r'), line.end());
+
+                // Search for the quote again, because the position might have changed
+                quotePos2 = line.find('"', quotePos1 + 1);
+
+                // Search for backslashes between the quotes
+                std::string::size_type backslashPos = line.find('\\', quotePos1);
+                while (backslashPos < quotePos2)
+                {
+                    // Check for special characters
+                    if (line[backslashPos + 1] == 'n')
+                    {
+                        line[backslashPos] = '\n';
+                        line.erase(backslashPos + 1, 1);
+                        --quotePos2;
+                    }
+                    else if (line[backslashPos + 1] == 't')
+                    {
+                        line[backslashPos] = '\t';
+                        line.erase(backslashPos + 1, 1);
+                        --quotePos2;
+                    }
+                    else if (line[backslashPos + 1] == '\\')
+                    {
+                        line.erase(backslashPos + 1, 1);
+                        --quotePos2;
+                    }
+                    else if (line[backslashPos + 1] == '"')
+                    {
+                        line[backslashPos] = '"';
+                        line.erase(backslashPos + 1, 1);
+
+                        // Find the next quote
+                        quotePos2 = line.find('"', backslashPos + 1);
+                        if (quotePos2 == std::string::npos)
+                            return false;
+                    }
+
+                    // Find the next backslash
+                    backslashPos = line.find('\\', backslashPos + 1);
+                }
+
+                // There may never be more than two quotes
+                if (line.find('"', quotePos2 + 1) != std::string::npos)
+                    return false;
+
+                // Convert the part behind the quote to lowercase
+                line = line.substr(0, quotePos2 + 1) + tgui::toLower(line.substr(quotePos2 + 1));
+
+                // Remove the quotes from the string
+                line.erase(quotePos1, 1);
+                line.erase(quotePos2 - 1, 1);
+            }
+            else // The second quote is missing
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Gets the properties of a widget like they are written to a widget file, with the value of string properties between
+    // quotes. The filename or config file of the widget always comes first.
+    void getFormProperties(const tgui::Widget::Ptr& widget, std::vector< std::pair<std::string, std::string> >& properties)
+    {
+        std::string value;
+        if (widget->getProperty("Filename", value))
+        {
+            properties.push_back(std::make_pair("Filename", "\"" + value + "\""));
+        }
+        else if (widget->getProperty("ConfigFile", value))
+        {
+            properties.push_back(std::make_pair("ConfigFile", "\"" + value + "\""));
+        }
+
+        auto propertyList = widget->getPropertyList();
+        for (auto propertyIt = propertyList.cbegin(); propertyIt != propertyList.cend(); ++propertyIt)
+        {
+            if ((propertyIt->first != "Filename") && (propertyIt->first != "ConfigFile"))
+            {
+                widget->getProperty(propertyIt->first, value);
+
+                if (propertyIt->second == "string")
+                    properties.push_back(std::make_pair(propertyIt->first, "\"" + value + "\""));
+                else
+                {
+                    if (!value.empty())
+                        properties.push_back(std::make_pair(propertyIt->first, value));
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The widget types that can be loaded from and saved to widget files
+    struct WidgetTypeRegistry
+    {
+        WidgetTypeRegistry();
+
+        template <typename T>
+        void addBuiltinType(const std::string& typeName, tgui::WidgetTypes widgetType)
+        {
+            add(typeName, typeid(T), [](tgui::Container& container, const sf::String& widgetName) { return tgui::Widget::Ptr(typename T::Ptr(container, widgetName)); });
+            builtinTypeNames[widgetType] = typeName;
+        }
+
+        void add(const std::string& typeName, const std::type_info& type, const tgui::Container::WidgetFactory& factory)
+        {
+            factories[tgui::toLower(typeName)] = factory;
+            typeNames[std::type_index(type)] = typeName;
+        }
+
+        // The factories are stored with the type name in lowercase
+        std::unordered_map<std::string, tgui::Container::WidgetFactory> factories;
+
+        // The type names of the registered classes, and of the built-in widget types for classes that inherit from them
+        std::unordered_map<std::type_index, std::string> typeNames;
+        std::unordered_map<int, std::string> builtinTypeNames;
+    };
+
+    WidgetTypeRegistry::WidgetTypeRegistry()
+    {
+        addBuiltinType<tgui::Tab>(            "Tab", tgui::Type_Tab);
+        addBuiltinType<tgui::Grid>(           "Grid", tgui::Type_Grid);
+        addBuiltinType<tgui::Panel>(          "Panel", tgui::Type_Panel);
+        addBuiltinType<tgui::Label>(          "Label", tgui::Type_Label);
+        addBuiltinType<tgui::Button>(         "Button", tgui::Type_Button);
+        addBuiltinType<tgui::Slider>(         "Slider", tgui::Type_Slider);
+        addBuiltinType<tgui::Picture>(        "Picture", tgui::Type_Picture);
+        addBuiltinType<tgui::ListBox>(        "ListBox", tgui::Type_ListBox);
+        addBuiltinType<tgui::EditBox>(        "EditBox", tgui::Type_EditBox);
+        addBuiltinType<tgui::TextBox>(        "TextBox", tgui::Type_TextBox);
+        addBuiltinType<tgui::ChatBox>(        "ChatBox", tgui::Type_ChatBox);
+        addBuiltinType<tgui::MenuBar>(        "MenuBar", tgui::Type_MenuBar);
+        addBuiltinType<tgui::Checkbox>(       "Checkbox", tgui::Type_Checkbox);
+        addBuiltinType<tgui::ComboBox>(       "ComboBox", tgui::Type_ComboBox);
+        addBuiltinType<tgui::Slider2d>(       "Slider2d", tgui::Type_Slider2d);
+        addBuiltinType<tgui::Scrollbar>(      "Scrollbar", tgui::Type_Scrollbar);
+        addBuiltinType<tgui::LoadingBar>(     "LoadingBar", tgui::Type_LoadingBar);
+        addBuiltinType<tgui::SpinButton>(     "SpinButton", tgui::Type_SpinButton);
+        addBuiltinType<tgui::RadioButton>(    "RadioButton", tgui::Type_RadioButton);
+        addBuiltinType<tgui::ChildWindow>(    "ChildWindow", tgui::Type_ChildWindow);
+        addBuiltinType<tgui::SpriteSheet>(    "SpriteSheet", tgui::Type_SpriteSheet);
+        addBuiltinType<tgui::AnimatedPicture>("AnimatedPicture", tgui::Type_AnimatedPicture);
+    }
+
+    WidgetTypeRegistry& getWidgetTypeRegistry()
+    {
+        static WidgetTypeRegistry registry;
+        return registry;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Returns the function that creates widgets of the given type, or nullptr when the type wasn't registered
+    const tgui::Container::WidgetFactory* findWidgetFactory(const std::string& lowercaseTypeName)
+    {
+        WidgetTypeRegistry& registry = getWidgetTypeRegistry();
+
+        auto it = registry.factories.find(lowercaseTypeName);
+        if (it != registry.factories.end())
+            return &it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Returns the name under which the widget is saved, or nullptr when the widget can't be saved in a widget file
+    const std::string* findWidgetTypeName(const tgui::Widget& widget)
+    {
+        WidgetTypeRegistry& registry = getWidgetTypeRegistry();
+
+        auto it = registry.typeNames.find(std::type_index(typeid(widget)));
+        if (it != registry.typeNames.end())
+            return &it->second;
+
+        // A class that inherits from a built-in widget is saved like the widget that it inherits from
+        auto builtinIt = registry.builtinTypeNames.find(widget.getWidgetType());
+        if (builtinIt != registry.builtinTypeNames.end())
+            return &builtinIt->second;
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Binary widget files start with this signature, followed by the version of the format
+    const char binaryFormSignature[8] = {'T', 'G', 'U', 'I', 'F', 'O', 'R', 'M'};
+    const sf::Uint32 binaryFormVersion = 2;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Numbers in binary widget files are always stored in little endian
+    void setUint32(std::vector<char>& buffer, std::size_t pos, sf::Uint32 value)
+    {
+        for (unsigned int i = 0; i < 4; ++i)
+            buffer[pos + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+
+    void writeUint32(std::vector<char>& buffer, sf::Uint32 value)
+    {
+        buffer.resize(buffer.size() + 4);
+        setUint32(buffer, buffer.size() - 4, value);
+    }
+
+    bool readUint32(const std::vector<char>& buffer, std::size_t& pos, sf::Uint32& value)
+    {
+        if (buffer.size() - pos < 4)
+            return false;
+
+        value = 0;
+        for (unsigned int i = 0; i < 4; ++i)
+            value |= static_cast<sf::Uint32>(static_cast<unsigned char>(buffer[pos + i])) << (8 * i);
+
+        pos += 4;
+        return true;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container() :
-        m_FocusedWidget(0)
+        m_EmptyWidgetSlots       (0),
+        m_FirstIndexedSlot       (0),
+        m_SpatialIndexEnabled    (false),
+        m_SpatialIndexCellSize   (128),
+        m_SpatialIndexNeedsUpdate(true),
+        m_WidgetBelowMouse       (nullptr),
+        m_FocusedWidget          (0),
+        m_NeedsRedraw            (true),
+        m_RenderCacheEnabled     (false),
+        m_ClipStack              (nullptr)
     {
         m_ContainerWidget = true;
-        m_AnimatedWidget = true;
         m_AllowFocus = true;
     }
 
@@ -47,18 +349,36 @@ namespace tgui
 
     Container::Container(const Container& containerToCopy) :
         Widget                   (containerToCopy),
+        m_EmptyWidgetSlots       (0),
+        m_FirstIndexedSlot       (0),
+        m_SpatialIndexEnabled    (containerToCopy.m_SpatialIndexEnabled),
+        m_SpatialIndexCellSize   (containerToCopy.m_SpatialIndexCellSize),
+        m_SpatialIndexNeedsUpdate(true),
+        m_WidgetBelowMouse       (nullptr),
         m_FocusedWidget          (0),
         m_GlobalFont             (containerToCopy.m_GlobalFont),
         m_ContainerFocused       (false),
-        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions)
+        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions),
+        m_NeedsRedraw            (true),
+        m_RenderCacheEnabled     (containerToCopy.m_RenderCacheEnabled),
+        m_ClipStack              (nullptr)
     {
         // Copy all the widgets
+        m_Widgets.reserve(containerToCopy.m_Widgets.size());
+        m_ObjName.reserve(containerToCopy.m_ObjName.size());
+        m_WidgetSlots.reserve(containerToCopy.m_Widgets.size());
+
         for (unsigned int i = 0; i < containerToCopy.m_Widgets.size(); ++i)
         {
+            // The slots of removed widgets are not copied
+            if (containerToCopy.m_Widgets[i] == nullptr)
+                continue;
+
             m_Widgets.push_back(containerToCopy.m_Widgets[i].clone());
             m_ObjName.push_back(containerToCopy.m_ObjName[i]);
 
             m_Widgets.back()->m_Parent = this;
+            indexWidget(m_Widgets.size() - 1);
         }
     }
 
@@ -66,7 +386,16 @@ namespace tgui
 
     Container::~Container()
     {
-        removeAllWidgets();
+        // The widgets can outlive the container, so they may no longer point to it. The lists are destroyed together with
+        // the container. Nothing is marked as changed, because the containers around this one may already be destroyed.
+        for (auto it = m_Widgets.begin(); it != m_Widgets.end(); ++it)
+        {
+            if (*it == nullptr)
+                continue;
+
+            (*it)->m_Parent = nullptr;
+            (*it)->m_NeedsUpdates = false;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,17 +412,29 @@ namespace tgui
             m_GlobalFont = right.m_GlobalFont;
             m_ContainerFocused = false;
             m_GlobalCallbackFunctions = right.m_GlobalCallbackFunctions;
+            m_SpatialIndexEnabled = right.m_SpatialIndexEnabled;
+            m_SpatialIndexCellSize = right.m_SpatialIndexCellSize;
+            m_RenderCacheEnabled = right.m_RenderCacheEnabled;
 
             // Remove all the old widgets
             removeAllWidgets();
 
             // Copy all the widgets
+            m_Widgets.reserve(right.m_Widgets.size());
+            m_ObjName.reserve(right.m_ObjName.size());
+            m_WidgetSlots.reserve(right.m_Widgets.size());
+
             for (unsigned int i = 0; i < right.m_Widgets.size(); ++i)
             {
+                // The slots of removed widgets are not copied
+                if (right.m_Widgets[i] == nullptr)
+                    continue;
+
                 m_Widgets.push_back(right.m_Widgets[i].clone());
                 m_ObjName.push_back(right.m_ObjName[i]);
 
                 m_Widgets.back()->m_Parent = this;
+                indexWidget(m_Widgets.size() - 1);
             }
         }
 
@@ -125,6 +466,10 @@ namespace tgui
 
     std::vector<Widget::Ptr>& Container::getWidgets()
     {
+        // The lists may not contain the empty slots of removed widgets when they are used outside the container
+        if (m_EmptyWidgetSlots > 0)
+            compactWidgets();
+
         return m_Widgets;
     }
 
@@ -132,6 +477,9 @@ namespace tgui
 
     std::vector<sf::String>& Container::getWidgetNames()
     {
+        if (m_EmptyWidgetSlots > 0)
+            compactWidgets();
+
         return m_ObjName;
     }
 
@@ -141,18 +489,33 @@ namespace tgui
     {
         assert(widgetPtr != nullptr);
 
-        widgetPtr->initialize(this);
         m_Widgets.push_back(widgetPtr);
         m_ObjName.push_back(widgetName);
+        indexWidget(m_Widgets.size() - 1);
+
+        // The widget is initialized after it was put in the lists, so that it can already ask this container for updates
+        widgetPtr->initialize(this);
+
+        addToSpatialIndex(m_Widgets.size() - 1);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
+        auto it = m_WidgetNameIndex.find(widgetName);
+        if (it == m_WidgetNameIndex.end())
+            return nullptr;
+
+        unsigned int slot = getWidgetSlot(it->second.front());
+        if ((slot < m_ObjName.size()) && (m_Widgets[slot] != nullptr) && (m_ObjName[slot] == widgetName))
+            return m_Widgets[slot];
+
+        // The names were changed without going through the container, so search the old fashioned way
         for (unsigned int i = 0; i < m_ObjName.size(); ++i)
         {
-            if (m_ObjName[i] == widgetName)
+            if ((m_Widgets[i] != nullptr) && (m_ObjName[i] == widgetName))
                 return m_Widgets[i];
         }
 
@@ -164,13 +527,45 @@ namespace tgui
     Widget::Ptr Container::copy(const Widget::Ptr& oldWidget, const sf::String& newWidgetName)
     {
         Widget::Ptr newWidget = oldWidget.clone();
+        newWidget->m_Parent = this;
         m_Widgets.push_back(newWidget);
         m_ObjName.push_back(newWidgetName);
+
+        indexWidget(m_Widgets.size() - 1);
+        addToSpatialIndex(m_Widgets.size() - 1);
+        markDirty();
         return newWidget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Widget::Ptr> Container::copy(const Widget::Ptr& oldWidget, const std::vector<sf::String>& newWidgetNames)
+    {
+        std::vector<Widget::Ptr> newWidgets;
+        newWidgets.reserve(newWidgetNames.size());
+
+        m_Widgets.reserve(m_Widgets.size() + newWidgetNames.size());
+        m_ObjName.reserve(m_ObjName.size() + newWidgetNames.size());
+        m_WidgetSlots.reserve(m_WidgetSlots.size() + newWidgetNames.size());
+
+        for (auto it = newWidgetNames.cbegin(); it != newWidgetNames.cend(); ++it)
+        {
+            Widget::Ptr newWidget = oldWidget.clone();
+            newWidget->m_Parent = this;
+            m_Widgets.push_back(newWidget);
+            m_ObjName.push_back(*it);
+            newWidgets.push_back(std::move(newWidget));
+
+            indexWidget(m_Widgets.size() - 1);
+            addToSpatialIndex(m_Widgets.size() - 1);
+        }
+
+        markDirty();
+        return newWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::remove(const Widget::Ptr& widget)
     {
         remove(widget.get());
@@ -180,34 +575,66 @@ namespace tgui
 
     void Container::remove(Widget* widget)
     {
-        // Loop through every widget
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            // Check if the pointer matches
-            if (m_Widgets[i].get() == widget)
-            {
-                // Unfocus the widget, just in case it was focused
-                if (widget->isFocused())
-                    unfocusWidgets();
+        auto slotIt = m_WidgetSlots.find(widget);
+        if (slotIt == m_WidgetSlots.end())
+            return;
 
-                // Remove the widget
-                m_Widgets.erase(m_Widgets.begin() + i);
+        int indexedSlot = slotIt->second;
+        unsigned int slot = getWidgetSlot(indexedSlot);
 
-                // Also emove the name it from the list
-                m_ObjName.erase(m_ObjName.begin() + i);
+        // Unfocus the widget, just in case it was focused
+        if (widget->isFocused())
+            unfocusWidgets();
 
-                break;
-            }
-        }
+        // The widget is no longer updated by anyone, it asks for updates again when it is added to a container
+        widget->setNeedsUpdates(false);
+
+        if (m_WidgetBelowMouse == widget)
+            m_WidgetBelowMouse = nullptr;
+
+        removeFromSpatialIndex(slot);
+        markDirty();
+
+        // The widget may still be used after it was removed, it should no longer point to this container
+        widget->m_Parent = nullptr;
+
+        // Remove the widget and its name from the lists
+        eraseWidgetSlot(slot, indexedSlot);
+
+        // Removing the empty slots costs as much as shifting the widgets for a single removal, so it only happens once in a while
+        if (m_EmptyWidgetSlots > 16 + m_Widgets.size() / 4)
+            compactWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::removeAllWidgets()
     {
+        // The widgets no longer need updates from this container
+        m_UpdatedWidgets.clear();
+        setNeedsUpdates(false);
+
+        // The widgets may still be used after they were removed, they should no longer point to this container or be updated
+        for (auto it = m_Widgets.begin(); it != m_Widgets.end(); ++it)
+        {
+            if (*it == nullptr)
+                continue;
+
+            (*it)->m_Parent = nullptr;
+            (*it)->m_NeedsUpdates = false;
+        }
+
         // Clear the lists
         m_Widgets.clear();
         m_ObjName.clear();
+        m_WidgetNameIndex.clear();
+        m_WidgetSlots.clear();
+        m_EmptyWidgetSlots = 0;
+        m_FirstIndexedSlot = 0;
+
+        m_WidgetBelowMouse = nullptr;
+        m_SpatialIndexNeedsUpdate = true;
+        markDirty();
 
         // There are no more widgets, so none of the widgets can be focused
         m_FocusedWidget = 0;
@@ -217,32 +644,31 @@ namespace tgui
 
     bool Container::setWidgetName(const Widget::Ptr& widget, const std::string& name)
     {
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            if (m_Widgets[i] == widget)
-            {
-                m_ObjName[i] = name;
-                return true;
-            }
-        }
+        auto slotIt = m_WidgetSlots.find(widget.get());
+        if (slotIt == m_WidgetSlots.end())
+            return false;
 
-        return false;
+        unsigned int slot = getWidgetSlot(slotIt->second);
+        sf::String oldName = m_ObjName[slot];
+
+        m_ObjName[slot] = name;
+
+        // Another widget with the old name may now have to be found instead
+        unindexWidgetName(oldName, slotIt->second);
+        indexWidget(slot);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Container::getWidgetName(const Widget::Ptr& widget, std::string& name) const
     {
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            if (m_Widgets[i] == widget)
-            {
-                name = m_ObjName[i];
-                return true;
-            }
-        }
+        auto slotIt = m_WidgetSlots.find(widget.get());
+        if (slotIt == m_WidgetSlots.end())
+            return false;
 
-        return false;
+        name = m_ObjName[getWidgetSlot(slotIt->second)];
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -256,30 +682,28 @@ namespace tgui
 
     void Container::focusWidget(Widget *const widget)
     {
-        // Loop all the widgets
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            // Search for the widget that has to be focused
-            if (m_Widgets[i].get() == widget)
-            {
-                // Only continue when the widget wasn't already focused
-                if (m_FocusedWidget != i+1)
-                {
-                    // Unfocus the currently focused widget
-                    if (m_FocusedWidget)
-                    {
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-                    }
+        // Search for the widget that has to be focused
+        auto slotIt = m_WidgetSlots.find(widget);
+        if (slotIt == m_WidgetSlots.end())
+            return;
 
-                    // Focus the new widget
-                    m_FocusedWidget = i+1;
-                    widget->m_Focused = true;
-                    widget->widgetFocused();
-                }
+        unsigned int slot = getWidgetSlot(slotIt->second);
 
-                break;
+        // Only continue when the widget wasn't already focused
+        if (m_FocusedWidget != slot+1)
+        {
+            // Unfocus the currently focused widget
+            if (m_FocusedWidget)
+            {
+                m_Widgets[m_FocusedWidget-1]->m_Focused = false;
+                m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
             }
+
+            // Focus the new widget
+            m_FocusedWidget = slot+1;
+            widget->m_Focused = true;
+            widget->widgetFocused();
+            markDirty();
         }
     }
 
@@ -290,8 +714,8 @@ namespace tgui
         // Loop all widgets behind the focused one
         for (unsigned int i = m_FocusedWidget; i < m_Widgets.size(); ++i)
         {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i]->m_AllowFocus == true)
+            // Skip removed widgets and widgets that you are not allowed to focus
+            if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_AllowFocus == true))
             {
                 // Make sure that the widget is visible and enabled
                 if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
@@ -307,6 +731,7 @@ namespace tgui
                     m_FocusedWidget = i+1;
                     m_Widgets[i]->m_Focused = true;
                     m_Widgets[i]->widgetFocused();
+                    markDirty();
                     return;
                 }
             }
@@ -317,8 +742,8 @@ namespace tgui
         {
             for (unsigned int i = 0; i < m_FocusedWidget - 1; ++i)
             {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_Widgets[i]->m_AllowFocus == true)
+                // Skip removed widgets and widgets that you are not allowed to focus
+                if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_AllowFocus == true))
                 {
                     // Make sure that the widget is visible and enabled
                     if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
@@ -331,6 +756,7 @@ namespace tgui
                         m_FocusedWidget = i+1;
                         m_Widgets[i]->m_Focused = true;
                         m_Widgets[i]->widgetFocused();
+                        markDirty();
 
                         return;
                     }
@@ -348,8 +774,8 @@ namespace tgui
         {
             for (unsigned int i = m_FocusedWidget - 1; i > 0; --i)
             {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_Widgets[i-1]->m_AllowFocus == true)
+                // Skip removed widgets and widgets that you are not allowed to focus
+                if ((m_Widgets[i-1] != nullptr) && (m_Widgets[i-1]->m_AllowFocus == true))
                 {
                     // Make sure that the widget is visible and enabled
                     if ((m_Widgets[i-1]->m_Visible) && (m_Widgets[i-1]->m_Enabled))
@@ -362,6 +788,7 @@ namespace tgui
                         m_FocusedWidget = i;
                         m_Widgets[i-1]->m_Focused = true;
                         m_Widgets[i-1]->widgetFocused();
+                        markDirty();
 
                         return;
                     }
@@ -372,8 +799,8 @@ namespace tgui
         // None of the widgets before the focused one could be focused, so loop all widgets behind the focused one
         for (unsigned int i = m_Widgets.size(); i > m_FocusedWidget; --i)
         {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i-1]->m_AllowFocus == true)
+            // Skip removed widgets and widgets that you are not allowed to focus
+            if ((m_Widgets[i-1] != nullptr) && (m_Widgets[i-1]->m_AllowFocus == true))
             {
                 // Make sure that the widget is visible and enabled
                 if ((m_Widgets[i-1]->m_Visible) && (m_Widgets[i-1]->m_Enabled))
@@ -389,6 +816,7 @@ namespace tgui
                     m_FocusedWidget = i;
                     m_Widgets[i-1]->m_Focused = true;
                     m_Widgets[i-1]->widgetFocused();
+                    markDirty();
                     return;
                 }
             }
@@ -404,6 +832,7 @@ namespace tgui
             m_Widgets[m_FocusedWidget-1]->m_Focused = false;
             m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
             m_FocusedWidget = 0;
+            markDirty();
         }
     }
 
@@ -414,7 +843,7 @@ namespace tgui
         // Loop through all radio buttons and uncheck them
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
         {
-            if (m_Widgets[i]->m_Callback.widgetType == Type_RadioButton)
+            if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_Callback.widgetType == Type_RadioButton))
                 static_cast<RadioButton::Ptr>(m_Widgets[i])->uncheck();
         }
     }
@@ -423,60 +852,77 @@ namespace tgui
 
     void Container::moveWidgetToFront(Widget *const widget)
     {
-        // Loop through all widgets
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            // Check if the widget is found
-            if (m_Widgets[i].get() == widget)
-            {
-                // Copy the widget
-                m_Widgets.push_back(m_Widgets[i]);
-                m_ObjName.push_back(m_ObjName[i]);
+        auto slotIt = m_WidgetSlots.find(widget);
+        if (slotIt == m_WidgetSlots.end())
+            return;
 
-                // Focus the correct widget
-                if ((m_FocusedWidget == 0) || (m_FocusedWidget == i+1))
-                    m_FocusedWidget = m_Widgets.size()-1;
-                else if (m_FocusedWidget > i+1)
-                    --m_FocusedWidget;
+        int indexedSlot = slotIt->second;
+        unsigned int slot = getWidgetSlot(indexedSlot);
 
-                // Remove the old widget
-                m_Widgets.erase(m_Widgets.begin() + i);
-                m_ObjName.erase(m_ObjName.begin() + i);
+        // Copy the widget
+        Widget::Ptr obj = m_Widgets[slot];
+        sf::String name = m_ObjName[slot];
 
-                break;
-            }
-        }
+        // The focus moves along with the widget, the other widgets keep their slot because the old one is left empty
+        bool moveFocus = (m_FocusedWidget == 0) || (m_FocusedWidget == slot+1);
+
+        // Remove the old widget and add it again behind the other widgets
+        removeFromSpatialIndex(slot);
+        eraseWidgetSlot(slot, indexedSlot);
+        m_Widgets.push_back(obj);
+        m_ObjName.push_back(name);
+        indexWidget(m_Widgets.size() - 1);
+        addToSpatialIndex(m_Widgets.size() - 1);
+
+        if (moveFocus)
+            m_FocusedWidget = m_Widgets.size();
+
+        if (m_EmptyWidgetSlots > 16 + m_Widgets.size() / 4)
+            compactWidgets();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::moveWidgetToBack(Widget *const widget)
     {
-        // Loop through all widgets
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            // Check if the widget is found
-            if (m_Widgets[i].get() == widget)
-            {
-                // Copy the widget
-                Widget::Ptr obj = m_Widgets[i];
-                std::string name = m_ObjName[i];
-                m_Widgets.insert(m_Widgets.begin(), obj);
-                m_ObjName.insert(m_ObjName.begin(), name);
-
-                // Focus the correct widget
-                if (m_FocusedWidget == i + 1)
-                    m_FocusedWidget = 1;
-                else if (m_FocusedWidget)
-                    ++m_FocusedWidget;
-
-                // Remove the old widget
-                m_Widgets.erase(m_Widgets.begin() + i + 1);
-                m_ObjName.erase(m_ObjName.begin() + i + 1);
-
-                break;
-            }
-        }
+        auto slotIt = m_WidgetSlots.find(widget);
+        if (slotIt == m_WidgetSlots.end())
+            return;
+
+        int indexedSlot = slotIt->second;
+        unsigned int slot = getWidgetSlot(indexedSlot);
+
+        // Copy the widget
+        Widget::Ptr obj = m_Widgets[slot];
+        sf::String name = m_ObjName[slot];
+
+        // Focus the correct widget (all other widgets move one slot to the back, the old slot is left empty)
+        unsigned int focusedWidget = m_FocusedWidget;
+        if (focusedWidget == slot + 1)
+            focusedWidget = 1;
+        else if (focusedWidget)
+            ++focusedWidget;
+
+        // Remove the old widget and add it again in front of the other widgets, with an id before all others in the lookup tables
+        removeFromSpatialIndex(slot);
+        eraseWidgetSlot(slot, indexedSlot);
+        --m_FirstIndexedSlot;
+        m_Widgets.insert(m_Widgets.begin(), obj);
+        m_ObjName.insert(m_ObjName.begin(), name);
+        indexWidget(0);
+
+        // The ids in the cells of the spatial index stay valid, only the remembered areas have to move along with the slots
+        if (m_SpatialIndexEnabled && !m_SpatialIndexNeedsUpdate)
+            m_IndexedWidgetAreas.insert(m_IndexedWidgetAreas.begin(), sf::FloatRect());
+        addToSpatialIndex(0);
+
+        m_FocusedWidget = focusedWidget;
+        if (m_EmptyWidgetSlots > 16 + m_Widgets.size() / 4)
+            compactWidgets();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -486,7 +932,10 @@ namespace tgui
         Widget::setTransparency(transparency);
 
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-            m_Widgets[i]->setTransparency(transparency);
+        {
+            if (m_Widgets[i] != nullptr)
+                m_Widgets[i]->setTransparency(transparency);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -507,18 +956,17 @@ namespace tgui
 
     bool Container::loadWidgetsFromFile(const std::string& filename)
     {
-        #define COMPARE_WIDGET(length, name, widgetName) \
-            if (line.substr(0, length).compare(name) == 0) \
-            { \
-                line.erase(0, length); \
-              \
-                widgetPtr.push_back(widgetName::Ptr(*static_cast<Container*>(widgetPtr.back()), line).get()); \
-                progress.push(0); \
-            }
-
         std::stack<unsigned int> progress;
         std::list<Widget*> widgetPtr;
 
+        // Files created by saveWidgetsToBinaryFile don't have to be parsed
+        {
+            std::ifstream binaryFile(getResourcePath() + filename, std::ifstream::binary);
+            char signature[sizeof(binaryFormSignature)];
+            if (binaryFile.read(signature, sizeof(signature)) && std::equal(signature, signature + sizeof(signature), binaryFormSignature))
+                return loadWidgetsFromBinaryFile(binaryFile);
+        }
+
         // Open the file
         std::ifstream m_File(getResourcePath() + filename);
 
@@ -533,105 +981,14 @@ namespace tgui
             std::string line;
             std::getline(m_File, line);
 
-            if (!line.empty())
+            if (!normalizeFormLine(line))
             {
-                // Search for a quote
-                std::string::size_type quotePos1 = line.find('"');
-
-                // Check if the quote was found or not
-                if (quotePos1 == std::string::npos)
-                {
-                    // Remove all spaces and tabs from the whole line
-                    line.erase(std::remove(line.begin(), line.end(), ' '), line.end());
-                    line.erase(std::remove(line.begin(), line.end(), '\t'), line.end());
-                    line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
-
-                    // Convert the whole line to lowercase
-                    line = toLower(line);
-                }
-                else // A quote was found
-                {
-                    // Only remove spaces and tabs until the quote
-                    line.erase(std::remove(line.begin(), line.begin() + quotePos1, ' '), line.begin() + quotePos1);
-                    quotePos1 = line.find('"');
-                    line.erase(std::remove(line.begin(), line.begin() + quotePos1, '\t'), line.begin() + quotePos1);
-                    quotePos1 = line.find('"');
-
-                    // Convert the part before the quote to lowercase
-                    line = toLower(line.substr(0, quotePos1)) + line.substr(quotePos1);
-
-                    // Search for a second quote
-                    std::string::size_type quotePos2 = line.find('"', quotePos1 + 1);
-
-                    // There must always be a second quote
-                    if (quotePos2 != std::string::npos)
-                    {
-                        // Remove all spaces and tabs after the quote
-                        line.erase(std::remove(line.begin() + quotePos2, line.end(), ' '), line.end());
-                        line.erase(std::remove(line.begin() + quotePos2, line.end(), '\t'), line.end());
-                        line.erase(std::remove(line.begin() + quotePos2, line.end(), '\r'), line.end());
-
-                        // Search for the quote again, because the position might have changed
-                        quotePos2 = line.find('"', quotePos1 + 1);
-
-                        // Search for backslashes between the quotes
-                        std::string::size_type backslashPos = line.find('\\', quotePos1);
-                        while (backslashPos < quotePos2)
-                        {
-                            // Check for special characters
-                            if (line[backslashPos + 1] == 'n')
-                            {
-                                line[backslashPos] = '\n';
-                                line.erase(backslashPos + 1, 1);
-                                --quotePos2;
-                            }
-                            else if (line[backslashPos + 1] == 't')
-                            {
-                                line[backslashPos] = '\t';
-                                line.erase(backslashPos + 1, 1);
-                                --quotePos2;
-                            }
-                            else if (line[backslashPos + 1] == '\\')
-                            {
-                                line.erase(backslashPos + 1, 1);
-                                --quotePos2;
-                            }
-                            else if (line[backslashPos + 1] == '"')
-                            {
-                                line[backslashPos] = '"';
-                                line.erase(backslashPos + 1, 1);
-
-                                // Find the next quote
-                                quotePos2 = line.find('"', backslashPos + 1);
-                                if (quotePos2 == std::string::npos)
-                                {
-                                    failed = true;
-                                    break;
-                                }
-                            }
-
-                            // Find the next backslash
-                            backslashPos = line.find('\\', backslashPos + 1);
-                        }
-
-                        // There may never be more than two quotes
-                        if (line.find('"', quotePos2 + 1) != std::string::npos)
-                            failed = true;
-
-                        // Convert the part behind the quote to lowercase
-                        line = line.substr(0, quotePos2 + 1) + toLower(line.substr(quotePos2 + 1));
-
-                        // Remove the quotes from the string
-                        line.erase(quotePos1, 1);
-                        line.erase(quotePos2 - 1, 1);
-                    }
-                    else // The second quote is missing
-                        failed = true;
-                }
+                failed = true;
+                break;
             }
 
-            // Only continue when the line hasn't become empty and nothing went wrong so far
-            if (!line.empty() && !failed)
+            // Only continue when the line hasn't become empty
+            if (!line.empty())
             {
                 // Check if this is the first line
                 if (progress.empty())
@@ -676,45 +1033,28 @@ namespace tgui
                 }
 
                 // The line doesn't contain a '}', so check if it contains another widget
-                bool widgetFound = true;
-                COMPARE_WIDGET(4, "tab:", Tab)
-                else COMPARE_WIDGET(5, "grid:", Grid)
-                else COMPARE_WIDGET(6, "panel:", Panel)
-                else COMPARE_WIDGET(6, "label:", Label)
-                else COMPARE_WIDGET(7, "button:", Button)
-                else COMPARE_WIDGET(7, "slider:", Slider)
-                else COMPARE_WIDGET(8, "picture:", Picture)
-                else COMPARE_WIDGET(8, "listbox:", ListBox)
-                else COMPARE_WIDGET(8, "editbox:", EditBox)
-                else COMPARE_WIDGET(8, "textbox:", TextBox)
-                else COMPARE_WIDGET(8, "chatbox:", ChatBox)
-                else COMPARE_WIDGET(8, "menubar:", MenuBar)
-                else COMPARE_WIDGET(9, "checkbox:", Checkbox)
-                else COMPARE_WIDGET(9, "combobox:", ComboBox)
-                else COMPARE_WIDGET(9, "slider2d:", Slider2d)
-                else COMPARE_WIDGET(10, "scrollbar:", Scrollbar)
-                else COMPARE_WIDGET(11, "loadingbar:", LoadingBar)
-                else COMPARE_WIDGET(11, "spinbutton:", SpinButton)
-                else COMPARE_WIDGET(12, "radiobutton:", RadioButton)
-                else COMPARE_WIDGET(12, "childwindow:", ChildWindow)
-                else COMPARE_WIDGET(12, "spritesheet:", SpriteSheet)
-                else COMPARE_WIDGET(16, "animatedpicture:", AnimatedPicture)
-                else
-                    widgetFound = false;
+                const WidgetFactory* factory = nullptr;
+                std::string::size_type colonPosition = line.find(':');
+                if (colonPosition != std::string::npos)
+                    factory = findWidgetFactory(line.substr(0, colonPosition));
 
-                // The line didn't contain a bracket or a new widget, so it must contain a property
-                if (!widgetFound)
+                if (factory)
                 {
-                    std::string::size_type equalSignPosition = line.find('=');
-                    if (equalSignPosition == std::string::npos)
-                    {
-                        failed = true;
-                        break;
-                    }
+                    widgetPtr.push_back((*factory)(*static_cast<Container*>(widgetPtr.back()), line.substr(colonPosition + 1)).get());
+                    progress.push(0);
+                    continue;
+                }
 
-                    if (!widgetPtr.back()->setProperty(line.substr(0, equalSignPosition), line.substr(equalSignPosition + 1)))
-                        failed = true;
+                // The line didn't contain a bracket or a new widget, so it must contain a property
+                std::string::size_type equalSignPosition = line.find('=');
+                if (equalSignPosition == std::string::npos)
+                {
+                    failed = true;
+                    break;
                 }
+
+                if (!widgetPtr.back()->setProperty(line.substr(0, equalSignPosition), line.substr(equalSignPosition + 1)))
+                    failed = true;
             }
         }
 
@@ -724,8 +1064,6 @@ namespace tgui
             return false;
 
         return true;
-
-        #undef COMPARE_WIDGET
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -751,82 +1089,223 @@ namespace tgui
             auto nameIt = widgetName.cbegin();
             for (auto widgetIt = widgets.cbegin(); widgetIt != widgets.cend(); ++widgetIt, ++nameIt)
             {
-                switch ((*widgetIt)->getWidgetType())
-                {
-                    case Type_Tab:              m_File << tabs << "Tab: "; break;
-                    case Type_Grid:             m_File << tabs << "Grid: "; break;
-                    case Type_Panel:            m_File << tabs << "Panel: "; break;
-                    case Type_Label:            m_File << tabs << "Label: "; break;
-                    case Type_Button:           m_File << tabs << "Button: "; break;
-                    case Type_Slider:           m_File << tabs << "Slider: "; break;
-                    case Type_Picture:          m_File << tabs << "Picture: "; break;
-                    case Type_ListBox:          m_File << tabs << "ListBox: "; break;
-                    case Type_EditBox:          m_File << tabs << "EditBox: "; break;
-                    case Type_TextBox:          m_File << tabs << "TextBox: "; break;
-                    case Type_ChatBox:          m_File << tabs << "ChatBox: "; break;
-                    case Type_MenuBar:          m_File << tabs << "MenuBar: "; break;
-                    case Type_Checkbox:         m_File << tabs << "Checkbox: "; break;
-                    case Type_ComboBox:         m_File << tabs << "ComboBox: "; break;
-                    case Type_Slider2d:         m_File << tabs << "Slider2d: "; break;
-                    case Type_Scrollbar:        m_File << tabs << "Scrollbar: "; break;
-                    case Type_LoadingBar:       m_File << tabs << "LoadingBar: "; break;
-                    case Type_SpinButton:       m_File << tabs << "SpinButton: "; break;
-                    case Type_RadioButton:      m_File << tabs << "RadioButton: "; break;
-                    case Type_ChildWindow:      m_File << tabs << "ChildWindow: "; break;
-                    case Type_SpriteSheet:      m_File << tabs << "SpriteSheet: "; break;
-                    case Type_AnimatedPicture:  m_File << tabs << "AnimatedPicture: "; break;
-                    default:
-                        continue;
-                }
+                // Skip the widgets that can't be loaded again
+                const std::string* typeName = findWidgetTypeName(**widgetIt);
+                if (!typeName)
+                    continue;
+
+                m_File << tabs << *typeName << ": ";
                 m_File << "\"" << nameIt->toAnsiString() << "\"" << std::endl;
 
                 m_File << tabs << "{" << std::endl;
                 tabs += "\t";
 
-                std::string value;
-                if ((*widgetIt)->getProperty("Filename", value))
+                std::vector< std::pair<std::string, std::string> > properties;
+                getFormProperties(*widgetIt, properties);
+                for (auto propertyIt = properties.cbegin(); propertyIt != properties.cend(); ++propertyIt)
+                    m_File << tabs << propertyIt->first << " = " << propertyIt->second << std::endl;
+
+                if ((*widgetIt)->m_ContainerWidget)
                 {
-                    m_File << tabs << "Filename = \"" << value << "\"" << std::endl;
+                    m_File << std::endl;
+                    saveWidgets(Container::Ptr(*widgetIt)->getWidgetNames(), Container::Ptr(*widgetIt)->getWidgets());
                 }
-                else if ((*widgetIt)->getProperty("ConfigFile", value))
+
+                tabs.erase(tabs.length()-1);
+                m_File << tabs << "}" << std::endl << std::endl;
+            }
+        };
+
+        saveWidgets(getWidgetNames(), getWidgets());
+
+        tabs.erase(tabs.length()-1);
+        m_File << tabs << "}" << std::endl;
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::saveWidgetsToBinaryFile(const std::string& filename)
+    {
+        // All strings are stored only once in the file, the widgets refer to them by index
+        std::vector<std::string> strings;
+        std::unordered_map<std::string, sf::Uint32> stringIndices;
+        auto getStringIndex = [&strings, &stringIndices] (const std::string& str) -> sf::Uint32
+        {
+            auto it = stringIndices.find(str);
+            if (it != stringIndices.end())
+                return it->second;
+
+            stringIndices[str] = static_cast<sf::Uint32>(strings.size());
+            strings.push_back(str);
+            return static_cast<sf::Uint32>(strings.size() - 1);
+        };
+
+        std::vector<char> widgetData;
+        bool failed = false;
+
+        std::function< void (std::vector<sf::String>&, std::vector<Widget::Ptr>&) > saveWidgets;
+        saveWidgets = [&widgetData, &failed, &getStringIndex, &saveWidgets] (std::vector<sf::String>& widgetName, std::vector<Widget::Ptr>& widgets)
+        {
+            // The amount of widgets is filled in when we know how many widgets could be saved
+            std::size_t widgetCountPos = widgetData.size();
+            sf::Uint32 widgetCount = 0;
+            writeUint32(widgetData, 0);
+
+            auto nameIt = widgetName.cbegin();
+            for (auto widgetIt = widgets.cbegin(); widgetIt != widgets.cend(); ++widgetIt, ++nameIt)
+            {
+                // Skip the widgets that can't be loaded again
+                const std::string* typeName = findWidgetTypeName(**widgetIt);
+                if (!typeName)
+                    continue;
+
+                widgetCount++;
+                writeUint32(widgetData, getStringIndex(*typeName));
+                writeUint32(widgetData, getStringIndex(nameIt->toAnsiString()));
+
+                // Store the properties exactly like they would be passed to setProperty when loading the text file
+                std::vector< std::pair<std::string, std::string> > properties;
+                getFormProperties(*widgetIt, properties);
+
+                writeUint32(widgetData, static_cast<sf::Uint32>(properties.size()));
+                for (auto propertyIt = properties.cbegin(); propertyIt != properties.cend(); ++propertyIt)
                 {
-                    m_File << tabs << "ConfigFile = \"" << value << "\"" << std::endl;
+                    std::string line = propertyIt->first + "=" + propertyIt->second;
+                    if (!normalizeFormLine(line))
+                        failed = true;
+
+                    std::string::size_type equalSignPosition = line.find('=');
+                    writeUint32(widgetData, getStringIndex(line.substr(0, equalSignPosition)));
+                    writeUint32(widgetData, getStringIndex(line.substr(equalSignPosition + 1)));
                 }
 
-                auto properties = (*widgetIt)->getPropertyList();
-                for (auto propertyIt = properties.cbegin(); propertyIt != properties.cend(); ++propertyIt)
-                {
-                    if ((propertyIt->first != "Filename") && (propertyIt->first != "ConfigFile"))
-                    {
-                        (*widgetIt)->getProperty(propertyIt->first, value);
+                if ((*widgetIt)->m_ContainerWidget)
+                    saveWidgets(Container::Ptr(*widgetIt)->getWidgetNames(), Container::Ptr(*widgetIt)->getWidgets());
+            }
+
+            setUint32(widgetData, widgetCountPos, widgetCount);
+        };
+
+        saveWidgets(getWidgetNames(), getWidgets());
+
+        std::vector<char> header(binaryFormSignature, binaryFormSignature + sizeof(binaryFormSignature));
+        writeUint32(header, binaryFormVersion);
+        writeUint32(header, static_cast<sf::Uint32>(strings.size()));
+        for (auto it = strings.cbegin(); it != strings.cend(); ++it)
+        {
+            writeUint32(header, static_cast<sf::Uint32>(it->length()));
+            header.insert(header.end(), it->begin(), it->end());
+        }
+
+        // Open the file
+        std::ofstream file(filename, std::ofstream::binary);
+
+        // Check if the file was not opened
+        if (file.is_open() == false)
+            return false;
+
+        file.write(header.data(), header.size());
+        file.write(widgetData.data(), widgetData.size());
+
+        return !failed && file.good();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::loadWidgetsFromBinaryFile(std::ifstream& file)
+    {
+        // Read the rest of the file at once
+        std::streampos dataStart = file.tellg();
+        file.seekg(0, std::ifstream::end);
+        std::streamoff dataSize = file.tellg() - dataStart;
+        file.seekg(dataStart);
+
+        std::vector<char> buffer(static_cast<std::size_t>(dataSize));
+        if (!buffer.empty() && !file.read(buffer.data(), buffer.size()))
+            return false;
+
+        std::size_t pos = 0;
+        sf::Uint32 version;
+        sf::Uint32 stringCount;
+        if (!readUint32(buffer, pos, version) || (version != binaryFormVersion) || !readUint32(buffer, pos, stringCount))
+            return false;
+
+        std::vector<std::string> strings;
+        strings.reserve(std::min<std::size_t>(stringCount, buffer.size() / 4));
+        for (sf::Uint32 i = 0; i < stringCount; ++i)
+        {
+            sf::Uint32 length;
+            if (!readUint32(buffer, pos, length) || (buffer.size() - pos < length))
+                return false;
+
+            strings.push_back(std::string(buffer.data() + pos, length));
+            pos += length;
+        }
+
+        // The widget types are only looked up the first time that they are used
+        std::vector<const WidgetFactory*> factories(strings.size(), nullptr);
+        return loadBinaryWidgets(buffer, pos, strings, factories);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::loadBinaryWidgets(const std::vector<char>& buffer, std::size_t& pos, const std::vector<std::string>& strings,
+                                      std::vector<const WidgetFactory*>& factories)
+    {
+        sf::Uint32 widgetCount;
+        if (!readUint32(buffer, pos, widgetCount))
+            return false;
+
+        for (sf::Uint32 i = 0; i < widgetCount; ++i)
+        {
+            sf::Uint32 typeIndex;
+            sf::Uint32 nameIndex;
+            if (!readUint32(buffer, pos, typeIndex) || (typeIndex >= strings.size())
+             || !readUint32(buffer, pos, nameIndex) || (nameIndex >= strings.size()))
+                return false;
+
+            if (!factories[typeIndex])
+            {
+                factories[typeIndex] = findWidgetFactory(toLower(strings[typeIndex]));
+                if (!factories[typeIndex])
+                    return false;
+            }
+
+            Widget* widget = (*factories[typeIndex])(*this, strings[nameIndex]).get();
 
-                        if (propertyIt->second == "string")
-                            m_File << tabs << propertyIt->first << " = \"" << value << "\"" << std::endl;
-                        else
-                        {
-                            if (!value.empty())
-                                m_File << tabs << propertyIt->first << " = " << value << std::endl;
-                        }
-                    }
-                }
+            sf::Uint32 propertyCount;
+            if (!readUint32(buffer, pos, propertyCount))
+                return false;
 
-                if ((*widgetIt)->m_ContainerWidget)
-                {
-                    m_File << std::endl;
-                    saveWidgets(Container::Ptr(*widgetIt)->getWidgetNames(), Container::Ptr(*widgetIt)->getWidgets());
-                }
+            for (sf::Uint32 j = 0; j < propertyCount; ++j)
+            {
+                sf::Uint32 propertyIndex;
+                sf::Uint32 valueIndex;
+                if (!readUint32(buffer, pos, propertyIndex) || (propertyIndex >= strings.size())
+                 || !readUint32(buffer, pos, valueIndex) || (valueIndex >= strings.size()))
+                    return false;
+
+                if (!widget->setProperty(strings[propertyIndex], strings[valueIndex]))
+                    return false;
+            }
 
-                tabs.erase(tabs.length()-1);
-                m_File << tabs << "}" << std::endl << std::endl;
+            if (widget->m_ContainerWidget)
+            {
+                if (!static_cast<Container*>(widget)->loadBinaryWidgets(buffer, pos, strings, factories))
+                    return false;
             }
-        };
+        }
 
-        saveWidgets(m_ObjName, m_Widgets);
+        return true;
+    }
 
-        tabs.erase(tabs.length()-1);
-        m_File << tabs << "}" << std::endl;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return true;
+    void Container::registerWidgetType(const std::string& typeName, const std::type_info& type, const WidgetFactory& factory)
+    {
+        getWidgetTypeRegistry().add(typeName, type, factory);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -835,7 +1314,10 @@ namespace tgui
     {
         // If there is no global callback function then send the callback to the parent
         if (m_GlobalCallbackFunctions.empty())
-            m_Parent->addChildCallback(callback);
+        {
+            if (m_Parent)
+                m_Parent->addChildCallback(callback);
+        }
         else
         {
             // Loop through all callback functions and call them
@@ -932,9 +1414,13 @@ namespace tgui
             mouseLeftWidget();
 
             for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            {
+                if (m_Widgets[i] != nullptr)
+                    m_Widgets[i]->mouseNotOnWidget();
+            }
 
             m_MouseHover = false;
+            markDirty();
         }
     }
 
@@ -943,9 +1429,13 @@ namespace tgui
     void Container::mouseNoLongerDown()
     {
         Widget::mouseNoLongerDown();
+        markDirty();
 
         for (unsigned int i=0; i<m_Widgets.size(); ++i)
-            m_Widgets[i]->mouseNoLongerDown();
+        {
+            if (m_Widgets[i] != nullptr)
+                m_Widgets[i]->mouseNoLongerDown();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -961,22 +1451,26 @@ namespace tgui
     {
         m_Parent = parent;
         setGlobalFont(m_Parent->getGlobalFont());
+
+        // The new parent has to update this container when one of its widgets needs updates
+        setNeedsUpdates(!m_UpdatedWidgets.empty());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::update()
     {
-        // Loop through all widgets
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        // Only the widgets that need updates are in the list. It is looped backwards because a widget can remove itself
+        // from the list while being updated (e.g. when an animation ends).
+        for (unsigned int i = m_UpdatedWidgets.size(); i > 0; --i)
         {
-            // Check if the widget is a container or a widget that uses the time
-            if (m_Widgets[i]->m_AnimatedWidget)
-            {
-                // Update the elapsed time
-                m_Widgets[i]->m_AnimationTimeElapsed += m_AnimationTimeElapsed;
-                m_Widgets[i]->update();
-            }
+            // A callback could have removed several widgets from the list
+            if (i > m_UpdatedWidgets.size())
+                continue;
+
+            Widget* widget = m_UpdatedWidgets[i-1];
+            widget->m_AnimationTimeElapsed += m_AnimationTimeElapsed;
+            widget->update();
         }
 
         m_AnimationTimeElapsed = sf::Time();
@@ -984,6 +1478,43 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Container::getTimeUntilUpdate() const
+    {
+        // The elapsed time of the container is added to the widgets during every update, so the times can be compared directly
+        sf::Time time = NoDeadline;
+        for (auto it = m_UpdatedWidgets.cbegin(); it != m_UpdatedWidgets.cend(); ++it)
+            time = std::min(time, (*it)->getTimeUntilUpdate());
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setWidgetNeedsUpdates(Widget* widget, bool needsUpdates)
+    {
+        auto it = std::find(m_UpdatedWidgets.begin(), m_UpdatedWidgets.end(), widget);
+        if (needsUpdates)
+        {
+            // Widgets that were copied still point to the parent of the original widget, but they aren't part of it
+            if ((it != m_UpdatedWidgets.end()) || (m_WidgetSlots.find(widget) == m_WidgetSlots.end()))
+                return;
+
+            m_UpdatedWidgets.push_back(widget);
+        }
+        else
+        {
+            if (it == m_UpdatedWidgets.end())
+                return;
+
+            m_UpdatedWidgets.erase(it);
+        }
+
+        // The container itself only has to be updated while one of its widgets needs it
+        setNeedsUpdates(!m_UpdatedWidgets.empty());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -993,12 +1524,14 @@ namespace tgui
             for (unsigned int i=0; i<m_Widgets.size(); ++i)
             {
                 // Check if the mouse went down on the widget
-                if (m_Widgets[i]->m_MouseDown)
+                if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_MouseDown))
                 {
                     // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
                     if ((m_Widgets[i]->m_DraggableWidget) || (m_Widgets[i]->m_ContainerWidget))
                     {
+                        // Dragging changes the widget, unlike just moving the mouse on top of it
                         m_Widgets[i]->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
+                        markDirty();
                         return true;
                     }
                 }
@@ -1008,7 +1541,7 @@ namespace tgui
             Widget::Ptr widget = mouseOnWhichWidget(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
             if (widget != nullptr)
             {
-                // Send the event to the widget
+                // Send the event to the widget (it marks itself as changed when the mouse enters or leaves it)
                 widget->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
                 return true;
             }
@@ -1042,6 +1575,7 @@ namespace tgui
                     }
 
                     widget->leftMousePressed(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
+                    markDirty();
                     return true;
                 }
                 else // The mouse didn't went down on a widget, so unfocus the focused widget
@@ -1065,10 +1599,12 @@ namespace tgui
                 // Tell all the other widgets that the mouse has gone up
                 for (std::vector<Widget::Ptr>::iterator it = m_Widgets.begin(); it != m_Widgets.end(); ++it)
                 {
-                    if (*it != widget)
+                    if ((*it != nullptr) && (*it != widget))
                         (*it)->mouseNoLongerDown();
                 }
 
+                markDirty();
+
                 if (widget != nullptr)
                     return true;
             }
@@ -1087,6 +1623,7 @@ namespace tgui
                 {
                     // Tell the widget that the key was pressed
                     m_Widgets[m_FocusedWidget-1]->keyPressed(event.key.code);
+                    markDirty();
 
                     return true;
                 }
@@ -1115,6 +1652,7 @@ namespace tgui
                 if (m_FocusedWidget)
                 {
                     m_Widgets[m_FocusedWidget-1]->textEntered(event.text.unicode);
+                    markDirty();
                     return true;
                 }
             }
@@ -1131,6 +1669,7 @@ namespace tgui
             {
                 // Send the event to the widget
                 widget->mouseWheelMoved(event.mouseWheel.delta, event.mouseWheel.x,  event.mouseWheel.y);
+                markDirty();
                 return true;
             }
 
@@ -1151,8 +1690,8 @@ namespace tgui
         // Loop through all widgets
         for (unsigned int i = m_FocusedWidget; i < m_Widgets.size(); ++i)
         {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i]->m_AllowFocus == true)
+            // Skip removed widgets and widgets that you are not allowed to focus
+            if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_AllowFocus == true))
             {
                 // Make sure that the widget is visible and enabled
                 if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
@@ -1171,6 +1710,7 @@ namespace tgui
                         m_FocusedWidget = i+1;
                         m_Widgets[i]->m_Focused = true;
                         m_Widgets[i]->widgetFocused();
+                        markDirty();
 
                         return true;
                     }
@@ -1205,8 +1745,8 @@ namespace tgui
         // Loop all widgets behind the focused one
         for (unsigned int i = m_FocusedWidget; i < m_Widgets.size(); ++i)
         {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i]->m_AllowFocus == true)
+            // Skip removed widgets and widgets that you are not allowed to focus
+            if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_AllowFocus == true))
             {
                 // Make sure that the widget is visible and enabled
                 if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
@@ -1222,6 +1762,7 @@ namespace tgui
                     m_FocusedWidget = i+1;
                     m_Widgets[i]->m_Focused = true;
                     m_Widgets[i]->widgetFocused();
+                    markDirty();
                     return true;
                 }
             }
@@ -1232,8 +1773,8 @@ namespace tgui
         {
             for (unsigned int i=0; i<m_FocusedWidget-1; ++i)
             {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_Widgets[i]->m_AllowFocus == true)
+                // Skip removed widgets and widgets that you are not allowed to focus
+                if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_AllowFocus == true))
                 {
                     // Make sure that the widget is visible and enabled
                     if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
@@ -1246,6 +1787,7 @@ namespace tgui
                         m_FocusedWidget = i+1;
                         m_Widgets[i]->m_Focused = true;
                         m_Widgets[i]->widgetFocused();
+                        markDirty();
                         return true;
                     }
                 }
@@ -1266,6 +1808,50 @@ namespace tgui
 
     Widget::Ptr Container::mouseOnWhichWidget(float x, float y)
     {
+        if (m_SpatialIndexEnabled)
+        {
+            checkChangedWidgets();
+            if (m_SpatialIndexNeedsUpdate)
+                rebuildSpatialIndex();
+
+            static const std::vector<int> emptyCell;
+            const std::vector<int>* cell = &emptyCell;
+
+            auto cellIt = m_SpatialIndexCells.find(getCellKey(static_cast<int>(std::floor(x / m_SpatialIndexCellSize)),
+                                                              static_cast<int>(std::floor(y / m_SpatialIndexCellSize))));
+            if (cellIt != m_SpatialIndexCells.end())
+                cell = &cellIt->second;
+
+            // Check the widgets in the cell and the widgets that are not in any cell, starting with the one in front
+            Widget::Ptr widget = nullptr;
+            unsigned int cellIndex = cell->size();
+            unsigned int unindexedIndex = m_UnindexedWidgets.size();
+            while ((cellIndex > 0) || (unindexedIndex > 0))
+            {
+                unsigned int slot;
+                if ((unindexedIndex == 0) || ((cellIndex > 0) && ((*cell)[cellIndex-1] > m_UnindexedWidgets[unindexedIndex-1])))
+                    slot = getWidgetSlot((*cell)[--cellIndex]);
+                else
+                    slot = getWidgetSlot(m_UnindexedWidgets[--unindexedIndex]);
+
+                if ((m_Widgets[slot]->m_Visible) && (m_Widgets[slot]->m_Enabled) && (m_Widgets[slot]->mouseOnWidget(x, y)))
+                {
+                    widget = m_Widgets[slot];
+                    break;
+                }
+            }
+
+            // Only the widget that was below the mouse before has to be told that the mouse left it
+            if ((m_WidgetBelowMouse != nullptr) && (m_WidgetBelowMouse != widget.get()))
+            {
+                m_WidgetBelowMouse->mouseNotOnWidget();
+                markDirty();
+            }
+
+            m_WidgetBelowMouse = widget.get();
+            return widget;
+        }
+
         bool widgetFound = false;
         Widget::Ptr widget = nullptr;
 
@@ -1273,7 +1859,7 @@ namespace tgui
         for (std::vector<Widget::Ptr>::reverse_iterator it = m_Widgets.rbegin(); it != m_Widgets.rend(); ++it)
         {
             // Check if the widget is visible and enabled
-            if (((*it)->m_Visible) && ((*it)->m_Enabled))
+            if ((*it != nullptr) && ((*it)->m_Visible) && ((*it)->m_Enabled))
             {
                 if (widgetFound == false)
                 {
@@ -1296,15 +1882,409 @@ namespace tgui
 
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
+        if (m_RenderCacheEnabled && updateRenderCache())
+            target->draw(sf::Sprite(m_RenderCache.getTexture()), states);
+        else
+            drawWidgets(*target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawWidgets(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        m_NeedsRedraw = false;
+
+        // The widgets inside this container clip against the same stack
+        const ClipStack* clipStack = (m_ClipStack != nullptr) ? m_ClipStack : getClipStack();
+
         // Draw all widgets when they are visible
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
         {
-            if (m_Widgets[i]->m_Visible)
-                m_Widgets[i]->draw(*target, states);
+            if ((m_Widgets[i] == nullptr) || !m_Widgets[i]->m_Visible)
+                continue;
+
+            // Skip widgets that lie completely outside the clipping area. An open menu of a menu bar lies outside the
+            // area of the menu bar, so menu bars are always drawn.
+            if ((clipStack != nullptr) && (m_Widgets[i]->m_Callback.widgetType != Type_MenuBar)
+             && !clipStack->isVisible(target, states.transform.transformRect(getWidgetArea(m_Widgets[i]))))
+                continue;
+
+            m_Widgets[i]->draw(target, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::updateRenderCache() const
+    {
+        sf::Vector2u size(static_cast<unsigned int>(std::ceil(getSize().x)), static_cast<unsigned int>(std::ceil(getSize().y)));
+
+        // An empty texture can't be created, but there is also nothing to see in that case
+        if ((size.x == 0) || (size.y == 0))
+            return false;
+
+        if (m_RenderCache.getSize() != size)
+        {
+            if (!m_RenderCache.create(size.x, size.y))
+            {
+                TGUI_OUTPUT("TGUI error: Failed to create the texture for the render cache, the widgets will be drawn directly.");
+                m_RenderCacheEnabled = false;
+                return false;
+            }
+
+            m_NeedsRedraw = true;
+        }
+
+        if (m_NeedsRedraw)
+        {
+            m_RenderCache.setActive(true);
+            m_RenderCache.clear(sf::Color::Transparent);
+
+            // The texture has its own clipping state, the widgets on it are only limited by the texture itself
+            ClipStack clipStack;
+            ClipStack* previousClipStack = m_ClipStack;
+            m_ClipStack = &clipStack;
+
+            clipStack.begin(m_RenderCache);
+            drawWidgets(m_RenderCache, sf::RenderStates::Default);
+            clipStack.end();
+
+            m_ClipStack = previousClipStack;
+            m_RenderCache.display();
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::indexWidget(unsigned int slot)
+    {
+        int indexedSlot = getIndexedSlot(slot);
+        m_WidgetSlots[m_Widgets[slot].get()] = indexedSlot;
+
+        // Widgets that still use the deprecated m_AnimatedWidget flag are always updated
+        if (m_Widgets[slot]->m_AnimatedWidget)
+            m_Widgets[slot]->m_NeedsUpdates = true;
+
+        // A widget that already needed updates before it was added will now be updated by this container
+        if (m_Widgets[slot]->m_NeedsUpdates)
+            setWidgetNeedsUpdates(m_Widgets[slot].get(), true);
+
+        // Widgets without a name can't be looked up by name
+        if (m_ObjName[slot].isEmpty())
+            return;
+
+        // When several widgets have the same name then the first one is found
+        std::vector<int>& indexedSlots = m_WidgetNameIndex[m_ObjName[slot]];
+        auto it = std::lower_bound(indexedSlots.begin(), indexedSlots.end(), indexedSlot);
+        if ((it == indexedSlots.end()) || (*it != indexedSlot))
+            indexedSlots.insert(it, indexedSlot);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Container::getWidgetSlot(int indexedSlot) const
+    {
+        return static_cast<unsigned int>(indexedSlot - m_FirstIndexedSlot);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int Container::getIndexedSlot(unsigned int slot) const
+    {
+        return m_FirstIndexedSlot + static_cast<int>(slot);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::eraseWidgetSlot(unsigned int slot, int indexedSlot)
+    {
+        m_WidgetSlots.erase(m_Widgets[slot].get());
+
+        // Another widget with the same name may now have to be found instead
+        unindexWidgetName(m_ObjName[slot], indexedSlot);
+
+        // The slot is left empty, so that the widgets behind it keep their slot
+        m_Widgets[slot] = nullptr;
+        m_ObjName[slot].clear();
+        ++m_EmptyWidgetSlots;
+
+        if (m_FocusedWidget == slot+1)
+            m_FocusedWidget = 0;
+
+        // Empty slots at the end of the lists can be removed without moving any other widget
+        while (!m_Widgets.empty() && (m_Widgets.back() == nullptr))
+        {
+            m_Widgets.pop_back();
+            m_ObjName.pop_back();
+            --m_EmptyWidgetSlots;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::unindexWidgetName(const sf::String& name, int indexedSlot)
+    {
+        if (name.isEmpty())
+            return;
+
+        auto it = m_WidgetNameIndex.find(name);
+        if (it == m_WidgetNameIndex.end())
+            return;
+
+        // The next widget with the same name (if any) is now the first one in the list
+        auto slotIt = std::lower_bound(it->second.begin(), it->second.end(), indexedSlot);
+        if ((slotIt != it->second.end()) && (*slotIt == indexedSlot))
+            it->second.erase(slotIt);
+
+        if (it->second.empty())
+            m_WidgetNameIndex.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::compactWidgets()
+    {
+        unsigned int newSlot = 0;
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            if (m_Widgets[i] == nullptr)
+                continue;
+
+            if (m_FocusedWidget == i+1)
+                m_FocusedWidget = newSlot+1;
+
+            if (newSlot != i)
+            {
+                m_Widgets[newSlot] = std::move(m_Widgets[i]);
+                m_ObjName[newSlot] = m_ObjName[i];
+            }
+
+            ++newSlot;
+        }
+
+        m_Widgets.resize(newSlot);
+        m_ObjName.resize(newSlot);
+        m_EmptyWidgetSlots = 0;
+
+        m_WidgetNameIndex.clear();
+        m_WidgetSlots.clear();
+        m_FirstIndexedSlot = 0;
+
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+            indexWidget(i);
+
+        // The widgets were moved to other slots, so the slots in the spatial index are no longer correct
+        m_SpatialIndexNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::enableSpatialIndex(float cellSize)
+    {
+        m_SpatialIndexEnabled = true;
+        m_SpatialIndexCellSize = (cellSize >= 1) ? cellSize : 1;
+        m_SpatialIndexNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::disableSpatialIndex()
+    {
+        m_SpatialIndexEnabled = false;
+        m_SpatialIndexNeedsUpdate = true;
+        m_WidgetBelowMouse = nullptr;
+
+        m_SpatialIndexCells.clear();
+        m_UnindexedWidgets.clear();
+        m_IndexedWidgetAreas.clear();
+        m_ChangedWidgets.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::enableRenderCache()
+    {
+        m_RenderCacheEnabled = true;
+
+        // The texture may still contain the widgets from when the cache was used before
+        markDirty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::disableRenderCache()
+    {
+        m_RenderCacheEnabled = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect Container::getWidgetArea(const Widget::Ptr& widget) const
+    {
+        sf::Vector2f position = widget->getPosition();
+        sf::Vector2f size = widget->getSize();
+        sf::Vector2f fullSize = widget->getFullSize();
+
+        // The borders may lie on any side of the widget, so the area is extended in all directions
+        sf::Vector2f borders(std::max(0.f, fullSize.x - size.x), std::max(0.f, fullSize.y - size.y));
+        return sf::FloatRect(position.x - borders.x, position.y - borders.y, fullSize.x + 2 * borders.x, fullSize.y + 2 * borders.y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::rebuildSpatialIndex()
+    {
+        m_SpatialIndexCells.clear();
+        m_UnindexedWidgets.clear();
+        m_ChangedWidgets.clear();
+        m_IndexedWidgetAreas.resize(m_Widgets.size());
+
+        m_SpatialIndexNeedsUpdate = false;
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            if (m_Widgets[i] != nullptr)
+                addToSpatialIndex(i);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::getSpatialIndexCells(unsigned int slot, int& left, int& top, int& right, int& bottom) const
+    {
+        // An open menu of a menu bar lies outside the area of the menu bar
+        if (m_Widgets[slot]->m_Callback.widgetType == Type_MenuBar)
+            return false;
+
+        const sf::FloatRect& area = m_IndexedWidgetAreas[slot];
+        left = static_cast<int>(std::floor(area.left / m_SpatialIndexCellSize));
+        top = static_cast<int>(std::floor(area.top / m_SpatialIndexCellSize));
+        right = static_cast<int>(std::floor((area.left + area.width) / m_SpatialIndexCellSize));
+        bottom = static_cast<int>(std::floor((area.top + area.height) / m_SpatialIndexCellSize));
+
+        // Big widgets (e.g. backgrounds) are not split over a lot of cells
+        return (right - left + 1) * (bottom - top + 1) <= 64;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToSpatialIndex(unsigned int slot)
+    {
+        // The widget will be put in the index together with all the others
+        if ((!m_SpatialIndexEnabled) || (m_SpatialIndexNeedsUpdate))
+            return;
+
+        if (slot >= m_IndexedWidgetAreas.size())
+            m_IndexedWidgetAreas.resize(slot + 1);
+
+        m_IndexedWidgetAreas[slot] = getWidgetArea(m_Widgets[slot]);
+
+        int indexedSlot = getIndexedSlot(slot);
+        int left, top, right, bottom;
+        if (!getSpatialIndexCells(slot, left, top, right, bottom))
+        {
+            insertSorted(m_UnindexedWidgets, indexedSlot);
+            return;
+        }
+
+        for (int x = left; x <= right; ++x)
+        {
+            for (int y = top; y <= bottom; ++y)
+                insertSorted(m_SpatialIndexCells[getCellKey(x, y)], indexedSlot);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromSpatialIndex(unsigned int slot)
+    {
+        if ((!m_SpatialIndexEnabled) || (m_SpatialIndexNeedsUpdate))
+            return;
+
+        int indexedSlot = getIndexedSlot(slot);
+        int left, top, right, bottom;
+        if (!getSpatialIndexCells(slot, left, top, right, bottom))
+        {
+            eraseSorted(m_UnindexedWidgets, indexedSlot);
+            return;
         }
+
+        for (int x = left; x <= right; ++x)
+        {
+            for (int y = top; y <= bottom; ++y)
+            {
+                auto cellIt = m_SpatialIndexCells.find(getCellKey(x, y));
+                if (cellIt == m_SpatialIndexCells.end())
+                    continue;
+
+                eraseSorted(cellIt->second, indexedSlot);
+                if (cellIt->second.empty())
+                    m_SpatialIndexCells.erase(cellIt);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetChanged(const Widget* widget)
+    {
+        // Nothing has to be remembered when the spatial index is rebuilt anyway
+        if ((!m_SpatialIndexEnabled) || (m_SpatialIndexNeedsUpdate))
+            return;
+
+        if (!m_ChangedWidgets.empty() && (m_ChangedWidgets.back() == widget))
+            return;
+
+        m_ChangedWidgets.push_back(widget);
+
+        // Don't let the list grow while the mouse isn't being used
+        if (m_ChangedWidgets.size() > 16 + m_Widgets.size() / 4)
+            checkChangedWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::checkChangedWidgets()
+    {
+        // The changed widgets don't matter when all widgets are put in the spatial index again
+        if (!m_SpatialIndexNeedsUpdate)
+        {
+            for (auto it = m_ChangedWidgets.begin(); it != m_ChangedWidgets.end(); ++it)
+            {
+                auto slotIt = m_WidgetSlots.find(*it);
+                if (slotIt == m_WidgetSlots.end())
+                    continue;
+
+                // A widget that was moved or resized is taken out of its old cells and put in the cells of its new area
+                unsigned int slot = getWidgetSlot(slotIt->second);
+                sf::FloatRect area = getWidgetArea(m_Widgets[slot]);
+                if ((area.left != m_IndexedWidgetAreas[slot].left) || (area.top != m_IndexedWidgetAreas[slot].top)
+                 || (area.width != m_IndexedWidgetAreas[slot].width) || (area.height != m_IndexedWidgetAreas[slot].height))
+                {
+                    removeFromSpatialIndex(slot);
+                    addToSpatialIndex(slot);
+                }
+            }
+        }
+
+        m_ChangedWidgets.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::WidgetNameHash::operator()(const sf::String& name) const
+    {
+        // FNV-1a hash over the UTF-32 characters
+        std::size_t hash = 2166136261u;
+        for (sf::String::ConstIterator it = name.begin(); it != name.end(); ++it)
+        {
+            hash ^= *it;
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void GuiContainer::unbindGlobalCallback()
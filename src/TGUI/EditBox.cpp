@@ -24,15 +24,64 @@
 
 
 #include <cmath>
+#include <algorithm>
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/EditBox.hpp>
 #include <TGUI/Clipboard.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the edit box
+    enum EditBoxProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Text,
+        Property_TextSize,
+        Property_PasswordCharacter,
+        Property_MaximumCharacters,
+        Property_Borders,
+        Property_TextColor,
+        Property_SelectedTextColor,
+        Property_SelectedTextBackgroundColor,
+        Property_SelectionPointColor,
+        Property_LimitTextWidth,
+        Property_SelectionPointWidth,
+        Property_NumbersOnly,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getEditBoxProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",                  "string",  Property_ConfigFile},
+            {"Text",                        "string",  Property_Text},
+            {"TextSize",                    "uint",    Property_TextSize},
+            {"PasswordCharacter",           "char",    Property_PasswordCharacter},
+            {"MaximumCharacters",           "uint",    Property_MaximumCharacters},
+            {"Borders",                     "borders", Property_Borders},
+            {"TextColor",                   "color",   Property_TextColor},
+            {"SelectedTextColor",           "color",   Property_SelectedTextColor},
+            {"SelectedTextBackgroundColor", "color",   Property_SelectedTextBackgroundColor},
+            {"SelectionPointColor",         "color",   Property_SelectionPointColor},
+            {"LimitTextWidth",              "bool",    Property_LimitTextWidth},
+            {"SelectionPointWidth",         "uint",    Property_SelectionPointWidth},
+            {"NumbersOnly",                 "bool",    Property_NumbersOnly},
+            {"Callback",                    "",        Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,12 +100,12 @@ namespace tgui
     m_MaxChars              (0),
     m_SplitImage            (false),
     m_TextCropPosition      (0),
+    m_CharacterPositions    (1, 0),
     m_PossibleDoubleClick   (false),
     m_NumbersOnly           (false),
     m_SeparateHoverImage    (false)
     {
         m_Callback.widgetType = Type_EditBox;
-        m_AnimatedWidget = true;
         m_DraggableWidget = true;
         m_AllowFocus = true;
 
@@ -90,6 +139,8 @@ namespace tgui
     m_TextSelection         (copy.m_TextSelection),
     m_TextAfterSelection    (copy.m_TextAfterSelection),
     m_TextFull              (copy.m_TextFull),
+    m_CharacterPositions    (copy.m_CharacterPositions),
+    m_TextMetrics           (copy.m_TextMetrics),
     m_PossibleDoubleClick   (copy.m_PossibleDoubleClick),
     m_NumbersOnly           (copy.m_NumbersOnly),
     m_SeparateHoverImage    (copy.m_SeparateHoverImage)
@@ -152,6 +203,8 @@ namespace tgui
             std::swap(m_TextSelection,          temp.m_TextSelection);
             std::swap(m_TextAfterSelection,     temp.m_TextAfterSelection);
             std::swap(m_TextFull,               temp.m_TextFull);
+            std::swap(m_CharacterPositions,     temp.m_CharacterPositions);
+            std::swap(m_TextMetrics,            temp.m_TextMetrics);
             std::swap(m_TextureNormal_L,        temp.m_TextureNormal_L);
             std::swap(m_TextureNormal_M,        temp.m_TextureNormal_M);
             std::swap(m_TextureNormal_R,        temp.m_TextureNormal_R);
@@ -184,6 +237,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
         m_Size.x = 0;
         m_Size.y = 0;
 
@@ -376,7 +430,7 @@ namespace tgui
                 setSize(static_cast<float>(m_TextureNormal_L.getSize().x + m_TextureNormal_M.getSize().x + m_TextureNormal_R.getSize().x),
                         static_cast<float>(m_TextureNormal_M.getSize().y));
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -389,13 +443,13 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Focused;
 
-                m_TextureFocused_M.data->texture.setRepeated(true);
+                m_TextureFocused_M.setRepeated(true);
             }
             if ((m_TextureHover_L.data != nullptr) && (m_TextureHover_M.data != nullptr) && (m_TextureHover_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureHover_M.data->texture.setRepeated(true);
+                m_TextureHover_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -458,9 +512,9 @@ namespace tgui
                 m_TextureNormal_M.sprite.setPosition(x + (m_TextureNormal_L.getSize().x * m_TextureNormal_L.sprite.getScale().x), y);
                 m_TextureFocused_M.sprite.setPosition(x + (m_TextureFocused_L.getSize().x * m_TextureFocused_L.sprite.getScale().x), y);
 
-                m_TextureHover_R.sprite.setPosition(m_TextureHover_M.sprite.getPosition().x + (m_TextureHover_M.sprite.getTextureRect().width * scalingY), y);
-                m_TextureNormal_R.sprite.setPosition(m_TextureNormal_M.sprite.getPosition().x + (m_TextureNormal_M.sprite.getTextureRect().width * scalingY), y);
-                m_TextureFocused_R.sprite.setPosition(m_TextureFocused_M.sprite.getPosition().x + (m_TextureFocused_M.sprite.getTextureRect().width * scalingY), y);
+                m_TextureHover_R.sprite.setPosition(m_TextureHover_M.sprite.getPosition().x + (m_TextureHover_M.getTextureRect().width * scalingY), y);
+                m_TextureNormal_R.sprite.setPosition(m_TextureNormal_M.sprite.getPosition().x + (m_TextureNormal_M.getTextureRect().width * scalingY), y);
+                m_TextureFocused_R.sprite.setPosition(m_TextureFocused_M.sprite.getPosition().x + (m_TextureFocused_M.getTextureRect().width * scalingY), y);
             }
             else // The middle image isn't drawn
             {
@@ -477,6 +531,8 @@ namespace tgui
         }
 
         recalculateTextPositions();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -487,6 +543,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Store the new size
         m_Size.x = width;
         m_Size.y = height;
@@ -512,9 +570,9 @@ namespace tgui
             m_TextureNormal_L.sprite.setScale(scalingY, scalingY);
             m_TextureFocused_L.sprite.setScale(scalingY, scalingY);
 
-            m_TextureHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
-            m_TextureNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
-            m_TextureFocused_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
+            m_TextureHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
+            m_TextureNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
+            m_TextureFocused_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
 
             m_TextureHover_M.sprite.setScale(scalingY, scalingY);
             m_TextureNormal_M.sprite.setScale(scalingY, scalingY);
@@ -547,6 +605,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Check if the text is auto sized
         if (m_TextSize == 0)
         {
@@ -594,6 +654,9 @@ namespace tgui
                 m_DisplayedText[i] = m_PasswordChar;
         }
 
+        // The font or text size may also have changed, so measure all characters
+        updateCharacterPositions(0);
+
         // Set the texts
         m_TextBeforeSelection.setString(m_DisplayedText);
         m_TextSelection.setString("");
@@ -615,11 +678,13 @@ namespace tgui
         if (m_LimitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            while (m_TextBeforeSelection.findCharacterPos(m_TextBeforeSelection.getString().getSize()).x > width)
+            unsigned int fittingCharacters = findCharactersFittingInWidth(width);
+            if (fittingCharacters < m_DisplayedText.getSize())
             {
-                // The text doesn't fit inside the EditBox, so the last character must be deleted.
-                m_Text.erase(m_Text.getSize()-1);
-                m_DisplayedText.erase(m_DisplayedText.getSize()-1);
+                // The text doesn't fit inside the EditBox, so the last characters must be deleted.
+                m_Text.erase(fittingCharacters, sf::String::InvalidPos);
+                m_DisplayedText.erase(fittingCharacters, sf::String::InvalidPos);
+                m_CharacterPositions.resize(fittingCharacters + 1);
 
                 // Set the new text
                 m_TextBeforeSelection.setString(m_DisplayedText);
@@ -631,7 +696,7 @@ namespace tgui
         else // There is no text cropping
         {
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = m_CharacterPositions.back();
 
             // If the text can be moved to the right then do so
             if (textWidth > width)
@@ -663,6 +728,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -681,7 +748,12 @@ namespace tgui
         m_TextAfterSelection.setFont(font);
         m_TextFull.setFont(font);
 
+        // The same font object may have been passed again after it was changed, so the cache is always thrown away
+        m_TextMetrics.invalidate();
+        updateCharacterPositions(0);
         recalculateTextPositions();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -699,6 +771,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Change the password character
         m_PasswordChar = passwordChar;
 
@@ -726,6 +800,7 @@ namespace tgui
             // Remove all the excess characters
             m_Text.erase(m_MaxChars, sf::String::InvalidPos);
             m_DisplayedText.erase(m_MaxChars, sf::String::InvalidPos);
+            m_CharacterPositions.resize(m_MaxChars + 1);
 
             // If we passed here then the text has changed.
             m_TextBeforeSelection.setString(m_DisplayedText);
@@ -736,6 +811,8 @@ namespace tgui
             // Set the selection point behind the last character
             setSelectionPointPosition(m_DisplayedText.getSize());
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -761,6 +838,8 @@ namespace tgui
         // Set the size of the selection point
         m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(m_SelectionPoint.getSize().x),
                                           m_Size.y - ((m_BottomBorder + m_TopBorder) * (m_Size.y / m_TextureNormal_M.getSize().y))));
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -784,6 +863,8 @@ namespace tgui
     {
         m_TextBeforeSelection.setColor(textColor);
         m_TextAfterSelection.setColor(textColor);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -791,6 +872,7 @@ namespace tgui
     void EditBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
         m_TextSelection.setColor(selectedTextColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -798,6 +880,7 @@ namespace tgui
     void EditBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
         m_SelectedTextBackground.setFillColor(selectedTextBackgroundColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -805,6 +888,7 @@ namespace tgui
     void EditBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
         m_SelectionPoint.setFillColor(selectionPointColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -856,11 +940,13 @@ namespace tgui
                 width = 0;
 
             // Now check if the text fits into the EditBox
-            while (m_TextBeforeSelection.findCharacterPos(m_DisplayedText.getSize()).x > width)
+            unsigned int fittingCharacters = findCharactersFittingInWidth(width);
+            if (fittingCharacters < m_DisplayedText.getSize())
             {
-                // The text doesn't fit inside the EditBox, so the last character must be deleted.
-                m_Text.erase(m_Text.getSize()-1);
-                m_DisplayedText.erase(m_DisplayedText.getSize()-1);
+                // The text doesn't fit inside the EditBox, so the last characters must be deleted.
+                m_Text.erase(fittingCharacters, sf::String::InvalidPos);
+                m_DisplayedText.erase(fittingCharacters, sf::String::InvalidPos);
+                m_CharacterPositions.resize(fittingCharacters + 1);
                 m_TextBeforeSelection.setString(m_DisplayedText);
             }
 
@@ -910,7 +996,7 @@ namespace tgui
                 width = 0;
 
             // Find out the position of the selection point
-            float selectionPointPosition = m_TextFull.findCharacterPos(m_SelEnd).x;
+            float selectionPointPosition = m_CharacterPositions[m_SelEnd];
 
             if (m_SelEnd == m_DisplayedText.getSize())
                 selectionPointPosition += m_TextFull.getCharacterSize() / 10.f;
@@ -925,6 +1011,8 @@ namespace tgui
         }
 
         recalculateTextPositions();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -935,6 +1023,7 @@ namespace tgui
         m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(width),
                                           m_Size.y - ((m_BottomBorder + m_TopBorder) * (m_Size.y / m_TextureNormal_M.getSize().y))));
 
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -978,6 +1067,8 @@ namespace tgui
             if (newText != m_Text)
                 setText(newText);
         }
+
+        markDirty();
     }
 
 
@@ -1139,19 +1230,19 @@ namespace tgui
                     }
                 }
                 // Check if the mouse is on the right of the text AND there is a possibility to scroll
-                else if ((x - getPosition().x > (m_LeftBorder * scalingX) + width) && (m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x > width))
+                else if ((x - getPosition().x > (m_LeftBorder * scalingX) + width) && (m_CharacterPositions.back() > width))
                 {
                     // Move the text by a few pixels
                     if (m_TextFull.getCharacterSize() > 10)
                     {
-                        if (m_TextCropPosition + width < m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10))
+                        if (m_TextCropPosition + width < m_CharacterPositions.back() + (m_TextFull.getCharacterSize() / 10))
                             m_TextCropPosition += static_cast<unsigned int>(std::floor(m_TextFull.getCharacterSize() / 10.f + 0.5f));
                         else
-                            m_TextCropPosition = static_cast<unsigned int>(m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10) - width);
+                            m_TextCropPosition = static_cast<unsigned int>(m_CharacterPositions.back() + (m_TextFull.getCharacterSize() / 10) - width);
                     }
                     else
                     {
-                        if (m_TextCropPosition + width < m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x)
+                        if (m_TextCropPosition + width < m_CharacterPositions.back())
                             ++m_TextCropPosition;
                     }
                 }
@@ -1301,6 +1392,7 @@ namespace tgui
                 // Erase the character
                 m_Text.erase(m_SelEnd-1, 1);
                 m_DisplayedText.erase(m_SelEnd-1, 1);
+                updateCharacterPositions(m_SelEnd-1);
 
                 // Set the selection point back on the correct position
                 setSelectionPointPosition(m_SelEnd - 1);
@@ -1317,7 +1409,7 @@ namespace tgui
                     width = 0;
 
                 // Calculate the text width
-                float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+                float textWidth = m_CharacterPositions.back();
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -1355,6 +1447,7 @@ namespace tgui
                 // Erase the character
                 m_Text.erase(m_SelEnd, 1);
                 m_DisplayedText.erase(m_SelEnd, 1);
+                updateCharacterPositions(m_SelEnd);
 
                 // Set the selection point back on the correct position
                 setSelectionPointPosition(m_SelEnd);
@@ -1371,7 +1464,7 @@ namespace tgui
                     width = 0;
 
                 // Calculate the text width
-                float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+                float textWidth = m_CharacterPositions.back();
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -1503,6 +1596,7 @@ namespace tgui
 
         // Append the character to the text
         m_TextFull.setString(m_DisplayedText);
+        updateCharacterPositions(m_SelEnd);
 
         // Calculate the space inside the edit box
         float width;
@@ -1515,11 +1609,13 @@ namespace tgui
         if (m_LimitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            if (m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x > width)
+            if (m_CharacterPositions.back() > width)
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_Text.erase(m_SelEnd, 1);
                 m_DisplayedText.erase(m_SelEnd, 1);
+                m_TextFull.setString(m_DisplayedText);
+                updateCharacterPositions(m_SelEnd);
                 return;
             }
         }
@@ -1542,112 +1638,141 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::widgetFocused()
+    {
+        // The selection point only blinks while the edit box is focused, it starts visible
+        m_SelectionPointVisible = true;
+        m_AnimationTimeElapsed = sf::Time();
+        setNeedsUpdates(true);
+
+        Widget::widgetFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::widgetUnfocused()
     {
         // If there is a selection then undo it now
         if (m_SelChars)
             setSelectionPointPosition(m_SelEnd);
 
+        setNeedsUpdates(false);
+
         Widget::widgetUnfocused();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool EditBox::setProperty(std::string property, const std::string& value)
+    bool EditBox::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "text")
+        switch (getEditBoxProperties().find(property))
         {
-            setText(value);
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "passwordcharacter")
-        {
-            if (!value.empty())
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Text:
+            {
+                setText(value);
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_PasswordCharacter:
             {
-                if (value.length() == 1)
-                    setPasswordCharacter(value[0]);
+                if (!value.empty())
+                {
+                    if (value.length() == 1)
+                        setPasswordCharacter(value[0]);
+                    else
+                        TGUI_OUTPUT("TGUI error: Failed to parse 'PasswordCharacter' propery.");
+                }
                 else
-                    TGUI_OUTPUT("TGUI error: Failed to parse 'PasswordCharacter' propery.");
+                    setPasswordCharacter('\0');
+                break;
             }
-            else
-                setPasswordCharacter('\0');
-        }
-        else if (property == "maximumcharacters")
-        {
-            setMaximumCharacters(atoi(value.c_str()));
-        }
-        else if (property == "borders")
-        {
-            Borders borders;
-            if (extractBorders(value, borders))
-                setBorders(borders.left, borders.top, borders.right, borders.bottom);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "selectedtextcolor")
-        {
-            setSelectedTextColor(extractColor(value));
-        }
-        else if (property == "selectedtextbackgroundcolor")
-        {
-            setSelectedTextBackgroundColor(extractColor(value));
-        }
-        else if (property == "selectionpointcolor")
-        {
-            setSelectionPointColor(extractColor(value));
-        }
-        else if (property == "limittextwidth")
-        {
-            if ((value == "true") || (value == "True"))
-                limitTextWidth(true);
-            else if ((value == "false") || (value == "False"))
-                limitTextWidth(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'LimitTextWidth' property.");
-        }
-        else if (property == "selectionpointwidth")
-        {
-            setSelectionPointWidth(atoi(value.c_str()));
-        }
-        else if (property == "numbersonly")
-        {
-            if ((value == "true") || (value == "True"))
-                setNumbersOnly(true);
-            else if ((value == "false") || (value == "False"))
-                setNumbersOnly(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'NumbersOnly' property.");
-        }
-        else if (property == "callback")
-        {
-            ClickableWidget::setProperty(property, value);
+            case Property_MaximumCharacters:
+            {
+                setMaximumCharacters(atoi(value.c_str()));
+                break;
+            }
+            case Property_Borders:
+            {
+                Borders borders;
+                if (extractBorders(value, borders))
+                    setBorders(borders.left, borders.top, borders.right, borders.bottom);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedTextColor:
+            {
+                setSelectedTextColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedTextBackgroundColor:
+            {
+                setSelectedTextBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_SelectionPointColor:
+            {
+                setSelectionPointColor(extractColor(value));
+                break;
+            }
+            case Property_LimitTextWidth:
+            {
+                if ((value == "true") || (value == "True"))
+                    limitTextWidth(true);
+                else if ((value == "false") || (value == "False"))
+                    limitTextWidth(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'LimitTextWidth' property.");
+                break;
+            }
+            case Property_SelectionPointWidth:
+            {
+                setSelectionPointWidth(atoi(value.c_str()));
+                break;
+            }
+            case Property_NumbersOnly:
+            {
+                if ((value == "true") || (value == "True"))
+                    setNumbersOnly(true);
+                else if ((value == "false") || (value == "False"))
+                    setNumbersOnly(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'NumbersOnly' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                ClickableWidget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "TextChanged") || (*it == "textchanged"))
-                    bindCallback(TextChanged);
-                else if ((*it == "ReturnKeyPressed") || (*it == "returnkeypressed"))
-                    bindCallback(ReturnKeyPressed);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "TextChanged") || (*it == "textchanged"))
+                        bindCallback(TextChanged);
+                    else if ((*it == "ReturnKeyPressed") || (*it == "returnkeypressed"))
+                        bindCallback(ReturnKeyPressed);
+                }
+                break;
             }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1655,65 +1780,80 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool EditBox::getProperty(std::string property, std::string& value) const
+    bool EditBox::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "text")
-            value = getText().toAnsiString();
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "passwordcharacter")
-        {
-            if (getPasswordCharacter())
-                value = getPasswordCharacter();
-            else
-                value = "";
-        }
-        else if (property == "maximumcharacters")
-            value = to_string(getMaximumCharacters());
-        else if (property == "borders")
-            value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "selectedtextcolor")
-            value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
-                    + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
-        else if (property == "selectedtextbackgroundcolor")
-            value = "(" + to_string(int(getSelectedTextBackgroundColor().r)) + "," + to_string(int(getSelectedTextBackgroundColor().g))
-                    + "," + to_string(int(getSelectedTextBackgroundColor().b)) + "," + to_string(int(getSelectedTextBackgroundColor().a)) + ")";
-        else if (property == "selectionpointcolor")
-            value = "(" + to_string(int(getSelectionPointColor().r)) + "," + to_string(int(getSelectionPointColor().g))
-                    + "," + to_string(int(getSelectionPointColor().b)) + "," + to_string(int(getSelectionPointColor().a)) + ")";
-        else if (property == "limittextwidth")
-            value = m_LimitTextWidth ? "true" : "false";
-        else if (property == "selectionpointwidth")
-            value = to_string(getSelectionPointWidth());
-        else if (property == "numbersonly")
-            value = m_NumbersOnly ? "true" : "false";
-        else if (property == "callback")
+        switch (getEditBoxProperties().find(property))
         {
-            std::string tempValue;
-            ClickableWidget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Text:
+                value = getText().toAnsiString();
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_PasswordCharacter:
+            {
+                if (getPasswordCharacter())
+                    value = getPasswordCharacter();
+                else
+                    value = "";
+                break;
+            }
+            case Property_MaximumCharacters:
+                value = to_string(getMaximumCharacters());
+                break;
+            case Property_Borders:
+                value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_SelectedTextColor:
+                value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
+                        + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
+                break;
+            case Property_SelectedTextBackgroundColor:
+                value = "(" + to_string(int(getSelectedTextBackgroundColor().r)) + "," + to_string(int(getSelectedTextBackgroundColor().g))
+                        + "," + to_string(int(getSelectedTextBackgroundColor().b)) + "," + to_string(int(getSelectedTextBackgroundColor().a)) + ")";
+                break;
+            case Property_SelectionPointColor:
+                value = "(" + to_string(int(getSelectionPointColor().r)) + "," + to_string(int(getSelectionPointColor().g))
+                        + "," + to_string(int(getSelectionPointColor().b)) + "," + to_string(int(getSelectionPointColor().a)) + ")";
+                break;
+            case Property_LimitTextWidth:
+                value = m_LimitTextWidth ? "true" : "false";
+                break;
+            case Property_SelectionPointWidth:
+                value = to_string(getSelectionPointWidth());
+                break;
+            case Property_NumbersOnly:
+                value = m_NumbersOnly ? "true" : "false";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                ClickableWidget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TextChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TextChanged).size() == 1) && (m_CallbackFunctions.at(TextChanged).front() == nullptr))
-                callbacks.push_back("TextChanged");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
-                callbacks.push_back("ReturnKeyPressed");
+                if ((m_CallbackFunctions.find(TextChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TextChanged).size() == 1) && (m_CallbackFunctions.at(TextChanged).front() == nullptr))
+                    callbacks.push_back("TextChanged");
+                if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+                    callbacks.push_back("ReturnKeyPressed");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1724,19 +1864,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > EditBox::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Text", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
-        list.push_back(std::pair<std::string, std::string>("PasswordCharacter", "char"));
-        list.push_back(std::pair<std::string, std::string>("MaximumCharacters", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Borders", "borders"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedTextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedTextBackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectionPointColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("LimitTextWidth", "bool"));
-        list.push_back(std::pair<std::string, std::string>("SelectionPointWidth", "uint"));
-        list.push_back(std::pair<std::string, std::string>("NumbersOnly", "bool"));
+        getEditBoxProperties().addToPropertyList(list);
         return list;
     }
 
@@ -1748,26 +1876,6 @@ namespace tgui
         if (m_DisplayedText.isEmpty())
             return 0;
 
-        // Find out what the first visible character is
-        unsigned int firstVisibleChar;
-        if (m_TextCropPosition)
-        {
-            // Start searching near the selection point to quickly find the character even in a very long string
-            firstVisibleChar = m_SelEnd;
-
-            // Go backwards to find the character
-            while (m_TextFull.findCharacterPos(firstVisibleChar-1).x > m_TextCropPosition)
-                --firstVisibleChar;
-        }
-        else // If the first part is visible then the first character is also visible
-            firstVisibleChar = 0;
-
-        sf::String tempString;
-        float textWidthWithoutLastChar;
-        float fullTextWidth;
-        float halfOfLastCharWidth;
-        unsigned int lastVisibleChar;
-
         // Calculate the space inside the edit box
         float width;
         if (m_SplitImage)
@@ -1779,12 +1887,24 @@ namespace tgui
         if (width < 0)
             width = 0;
 
+        // Find out what the first visible character is (the first one that starts behind the cropped part)
+        unsigned int firstVisibleChar = 0;
+        if (m_TextCropPosition)
+            firstVisibleChar = std::min(findCharactersFittingInWidth(static_cast<float>(m_TextCropPosition)) + 1, static_cast<unsigned int>(m_DisplayedText.getSize()));
+
+        // Find out what the last visible character is (the one in front of the first character that ends outside the edit box)
+        unsigned int lastVisibleChar = std::lower_bound(m_CharacterPositions.begin(), m_CharacterPositions.end(), m_TextCropPosition + width) - m_CharacterPositions.begin();
+        if (lastVisibleChar > 0)
+            --lastVisibleChar;
+
+        lastVisibleChar = std::max(firstVisibleChar, lastVisibleChar);
+
         // Find out how many pixels the text is moved
         float pixelsToMove = 0;
         if (m_TextAlignment != Alignment::Left)
         {
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = m_CharacterPositions.back();
 
             // Check if a layout would make sense
             if (textWidth < width)
@@ -1797,48 +1917,23 @@ namespace tgui
             }
         }
 
-        // Find out what the last visible character is, starting from the selection point
-        lastVisibleChar = m_SelEnd;
+        // Convert the position to a position inside the text
+        posX += m_TextCropPosition - pixelsToMove;
 
-        // Go forward to find the character
-        while (m_TextFull.findCharacterPos(lastVisibleChar+1).x < m_TextCropPosition + width)
+        // Search for the first visible character of which you clicked on the left halve
+        unsigned int low = firstVisibleChar;
+        unsigned int high = lastVisibleChar;
+        while (low < high)
         {
-            if (lastVisibleChar == m_DisplayedText.getSize())
-                break;
-
-            ++lastVisibleChar;
-        }
-
-        // Set the first part of the text
-        tempString = m_DisplayedText.toWideString().substr(0, firstVisibleChar);
-        m_TextFull.setString(tempString);
-
-        // Calculate the first position
-        fullTextWidth = m_TextFull.findCharacterPos(firstVisibleChar).x;
-
-        // for all the other characters, check where you have clicked.
-        for (unsigned int i = firstVisibleChar; i < lastVisibleChar; ++i)
-        {
-            // Add the next character to the temporary string
-            tempString += m_DisplayedText[i];
-            m_TextFull.setString(tempString);
-
-            // Make some calculations
-            textWidthWithoutLastChar = fullTextWidth;
-            fullTextWidth = m_TextFull.findCharacterPos(i + 1).x;
-            halfOfLastCharWidth = (fullTextWidth - textWidthWithoutLastChar) / 2.0f;
-
-            // Check if you have clicked on the first halve of that character
-            if (posX < textWidthWithoutLastChar + pixelsToMove + halfOfLastCharWidth - m_TextCropPosition)
-            {
-                m_TextFull.setString(m_DisplayedText);
-                return i;
-            }
+            unsigned int middle = low + (high - low) / 2;
+            if (posX < (m_CharacterPositions[middle] + m_CharacterPositions[middle + 1]) / 2.0f)
+                high = middle;
+            else
+                low = middle + 1;
         }
 
-        // If you pass here then you clicked behind all the characters
-        m_TextFull.setString(m_DisplayedText);
-        return lastVisibleChar;
+        // When you clicked behind all the characters then this will be the last visible character
+        return low;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1855,6 +1950,7 @@ namespace tgui
             // Erase the characters
             m_Text.erase(m_SelStart, m_SelChars);
             m_DisplayedText.erase(m_SelStart, m_SelChars);
+            updateCharacterPositions(m_SelStart);
 
             // Set the selection point back on the correct position
             setSelectionPointPosition(m_SelStart);
@@ -1864,6 +1960,7 @@ namespace tgui
             // Erase the characters
             m_Text.erase(m_SelEnd, m_SelChars);
             m_DisplayedText.erase(m_SelEnd, m_SelChars);
+            updateCharacterPositions(m_SelEnd);
 
             // Set the selection point back on the correct position
             setSelectionPointPosition(m_SelEnd);
@@ -1881,7 +1978,7 @@ namespace tgui
             width = 0;
 
         // Calculate the text width
-        float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+        float textWidth = m_CharacterPositions.back();
 
         // If the text can be moved to the right then do so
         if (textWidth > width)
@@ -1895,6 +1992,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::updateCharacterPositions(unsigned int firstChangedCharacter)
+    {
+        // When the font has changed then the cached advances are thrown away
+        m_TextMetrics.setFont(m_TextFull.getFont(), m_TextFull.getCharacterSize());
+
+        m_CharacterPositions.resize(m_DisplayedText.getSize() + 1);
+
+        // Only the characters behind the changed one move
+        float position = m_CharacterPositions[firstChangedCharacter];
+        sf::Uint32 previousChar = (firstChangedCharacter > 0) ? m_DisplayedText[firstChangedCharacter - 1] : 0;
+        for (unsigned int i = firstChangedCharacter; i < m_DisplayedText.getSize(); ++i)
+        {
+            position += m_TextMetrics.getAdvance(previousChar, m_DisplayedText[i]);
+            m_CharacterPositions[i + 1] = position;
+
+            previousChar = m_DisplayedText[i];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int EditBox::findCharactersFittingInWidth(float width) const
+    {
+        // The first position is always 0, so the result is at least 0
+        return std::upper_bound(m_CharacterPositions.begin(), m_CharacterPositions.end(), width) - m_CharacterPositions.begin() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         float textX = getPosition().x;
@@ -1920,7 +2046,7 @@ namespace tgui
             float width = m_Size.x - ((m_LeftBorder + m_RightBorder) * borderScale);
 
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = m_CharacterPositions.back();
 
             // Check if a layout would make sense
             if (textWidth < width)
@@ -1946,31 +2072,37 @@ namespace tgui
         // Check if there is a selection
         if (m_SelChars != 0)
         {
+            unsigned int selectionStart = m_TextBeforeSelection.getString().getSize();
+            unsigned int selectionEnd = selectionStart + m_TextSelection.getString().getSize();
+
             // Watch out for the kerning
-            if (m_TextBeforeSelection.getString().getSize() > 0)
-                textX += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[m_TextBeforeSelection.getString().getSize() - 1], m_DisplayedText[m_TextBeforeSelection.getString().getSize()], m_TextBeforeSelection.getCharacterSize());
+            float kerning = 0;
+            if (selectionStart > 0)
+                kerning = static_cast<float>(m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[selectionStart - 1], m_DisplayedText[selectionStart], m_TextBeforeSelection.getCharacterSize()));
 
-            textX += m_TextBeforeSelection.findCharacterPos(m_TextBeforeSelection.getString().getSize()).x - m_TextBeforeSelection.getPosition().x;
+            textX += kerning + m_CharacterPositions[selectionStart];
+
+            // The selected text is drawn separately, so it doesn't include the kerning with the character in front of it
+            float selectionWidth = m_CharacterPositions[selectionEnd] - m_CharacterPositions[selectionStart] - kerning;
 
             // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_SelectedTextBackground.setSize(sf::Vector2f(m_TextSelection.findCharacterPos(m_TextSelection.getString().getSize()).x - m_TextSelection.getPosition().x,
-                                                          (m_Size.y - ((m_TopBorder + m_BottomBorder) * scaling.y))));
+            m_SelectedTextBackground.setSize(sf::Vector2f(selectionWidth, (m_Size.y - ((m_TopBorder + m_BottomBorder) * scaling.y))));
             m_SelectedTextBackground.setPosition(std::floor(textX + 0.5f), std::floor(getPosition().y + (m_TopBorder * scaling.y) + 0.5f));
 
             // Set the text selected text on the correct position
             m_TextSelection.setPosition(std::floor(textX + 0.5f), std::floor(textY + 0.5f));
 
             // Watch out for kerning
-            if (m_DisplayedText.getSize() > m_TextBeforeSelection.getString().getSize() + m_TextSelection.getString().getSize())
-                textX += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[m_TextBeforeSelection.getString().getSize() + m_TextSelection.getString().getSize() - 1], m_DisplayedText[m_TextBeforeSelection.getString().getSize() + m_TextSelection.getString().getSize()], m_TextBeforeSelection.getCharacterSize());
+            if (m_DisplayedText.getSize() > selectionEnd)
+                textX += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[selectionEnd - 1], m_DisplayedText[selectionEnd], m_TextBeforeSelection.getCharacterSize());
 
             // Set the text selected text on the correct position
-            textX += m_TextSelection.findCharacterPos(m_TextSelection.getString().getSize()).x  - m_TextSelection.getPosition().x;
+            textX += selectionWidth;
             m_TextAfterSelection.setPosition(std::floor(textX + 0.5f), std::floor(textY + 0.5f));
         }
 
         // Set the position of the selection point
-        selectionPointLeft += m_TextFull.findCharacterPos(m_SelEnd).x - (m_SelectionPoint.getSize().x * 0.5f);
+        selectionPointLeft += m_CharacterPositions[m_SelEnd] - (m_SelectionPoint.getSize().x * 0.5f);
         m_SelectionPoint.setPosition(std::floor(selectionPointLeft + 0.5f), std::floor((m_TopBorder * scaling.y) + getPosition().y + 0.5f));
     }
 
@@ -2000,12 +2132,26 @@ namespace tgui
         // Switch the value of the visible flag
         m_SelectionPointVisible = !m_SelectionPointVisible;
 
+        // The selection point is only drawn while the edit box is focused
+        if (m_Focused)
+            markDirty();
+
         // Too slow for double clicking
         m_PossibleDoubleClick = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time EditBox::getTimeUntilUpdate() const
+    {
+        if (m_AnimationTimeElapsed < sf::milliseconds(500))
+            return sf::milliseconds(500) - m_AnimationTimeElapsed;
+        else
+            return sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Don't draw anything when the edit box was not loaded correctly
@@ -2018,38 +2164,28 @@ namespace tgui
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    drawSprites(target, states, {&m_TextureHover_L.sprite, &m_TextureHover_M.sprite, &m_TextureHover_R.sprite});
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    drawSprites(target, states, {&m_TextureNormal_L.sprite, &m_TextureNormal_M.sprite, &m_TextureNormal_R.sprite});
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureNormal_L, states);
-                target.draw(m_TextureNormal_M, states);
-                target.draw(m_TextureNormal_R, states);
+                drawSprites(target, states, {&m_TextureNormal_L.sprite, &m_TextureNormal_M.sprite, &m_TextureNormal_R.sprite});
 
                 // When the mouse is on top of the edit box then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    drawSprites(target, states, {&m_TextureHover_L.sprite, &m_TextureHover_M.sprite, &m_TextureHover_R.sprite});
                 }
             }
 
             // When the edit box is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_L, states);
-                target.draw(m_TextureFocused_M, states);
-                target.draw(m_TextureFocused_R, states);
+                drawSprites(target, states, {&m_TextureFocused_L.sprite, &m_TextureFocused_M.sprite, &m_TextureFocused_R.sprite});
             }
         }
         else // The images aren't split
@@ -2085,10 +2221,6 @@ namespace tgui
         else
             borderScale = scaling.x;
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         sf::Vector2f viewPosition = (target.getView().getSize() / 2.f) - target.getView().getCenter();
 
         // Get the global position
@@ -2097,24 +2229,9 @@ namespace tgui
         sf::Vector2f bottomRightPosition = states.transform.transformPoint(getPosition().x + (m_Size.x - (m_RightBorder * borderScale)) + viewPosition.x,
                                                                        getPosition().y + (m_Size.y - (m_BottomBorder * scaling.y)) + viewPosition.y);
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
 
         target.draw(m_TextBeforeSelection, states);
 
@@ -2131,7 +2248,7 @@ namespace tgui
             target.draw(m_SelectionPoint, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        clipping.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,14 +55,8 @@ Form::Form(tgui::Container& parent,
         square->load(IMAGES_FOLDER "/square/square.conf");
         square->hide();
 
-        window->copy(square, "LeftSquare");
-        window->copy(square, "TopLeftSquare");
-        window->copy(square, "TopSquare");
-        window->copy(square, "TopRightSquare");
-        window->copy(square, "RightSquare");
-        window->copy(square, "BottomRightSquare");
-        window->copy(square, "BottomSquare");
-        window->copy(square, "BottomLeftSquare");
+        window->copy(square, {"LeftSquare", "TopLeftSquare", "TopSquare", "TopRightSquare",
+                              "RightSquare", "BottomRightSquare", "BottomSquare", "BottomLeftSquare"});
 
         repositionSelectionSquares();
     }
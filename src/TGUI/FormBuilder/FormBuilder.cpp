@@ -55,9 +55,15 @@ int FormBuilder::run()
     while (window.isOpen())
     {
         handleEvents();
-        draw();
 
-        sf::sleep(sf::milliseconds(1));
+        // Only draw the window again when something changed
+        gui.updateTime();
+        if (gui.needsRedraw())
+            draw();
+
+        // Wait until a widget changes by itself, but keep checking for events regularly because sfml can't wait for
+        // an event with a timeout
+        sf::sleep(std::min(gui.getTimeUntilUpdate(), sf::milliseconds(10)));
     }
 
     return 0;
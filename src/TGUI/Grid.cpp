@@ -57,7 +57,7 @@ namespace tgui
                 for (unsigned int i = 0; i < widgets.size(); ++i)
                 {
                     // If a widget matches then add it to the grid
-                    if (widgets[i] == gridToCopy.m_GridWidgets[row][col])
+                    if ((widgets[i] != nullptr) && (widgets[i] == gridToCopy.m_GridWidgets[row][col]))
                         addWidget(widgets[i], row, col, gridToCopy.m_ObjBorders[row][col], gridToCopy.m_ObjLayout[row][col]);
                 }
             }
@@ -112,6 +112,8 @@ namespace tgui
         m_IntendedSize.y = height;
 
         updatePositionsOfAllWidgets();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +181,8 @@ namespace tgui
         }
 
         Container::remove(widget);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -196,6 +200,8 @@ namespace tgui
 
         m_Size.x = 0;
         m_Size.y = 0;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,6 +283,8 @@ namespace tgui
 
         // Reposition all widgets
         updatePositionsOfAllWidgets();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -298,6 +306,8 @@ namespace tgui
                 }
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -390,6 +400,8 @@ namespace tgui
                 }
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -536,7 +548,10 @@ namespace tgui
 
             // Tell the widgets inside the grid that the mouse is no longer on top of them
             for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            {
+                if (m_Widgets[i] != nullptr)
+                    m_Widgets[i]->mouseNotOnWidget();
+            }
 
             m_MouseHover = false;
         }
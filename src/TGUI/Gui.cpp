@@ -23,20 +23,30 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Gui.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    bool isSameView(const sf::View& left, const sf::View& right)
+    {
+        return (left.getCenter() == right.getCenter()) && (left.getSize() == right.getSize())
+            && (left.getRotation() == right.getRotation()) && (left.getViewport() == right.getViewport());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
-    m_Window (nullptr),
-    m_Focused(true)
+    m_Window           (nullptr),
+    m_Focused          (true),
+    m_FrameCacheEnabled(false)
     {
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
 
@@ -47,8 +57,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui(sf::RenderWindow& window) :
-    m_Window (&window),
-    m_Focused(true)
+    m_Window           (&window),
+    m_Focused          (true),
+    m_FrameCacheEnabled(false)
     {
         m_Container.m_Window = &window;
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
@@ -63,6 +74,7 @@ namespace tgui
     {
         m_Window = &window;
         m_Container.m_Window = &window;
+        m_Container.markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,9 +131,17 @@ namespace tgui
         {
             m_Focused = false;
         }
+        // The window contents may have been lost while another window was on top of it
         else if (event.type == sf::Event::GainedFocus)
         {
             m_Focused = true;
+            m_Container.markDirty();
+        }
+
+        // The widgets have to be drawn again on a resized window
+        else if (event.type == sf::Event::Resized)
+        {
+            m_Container.markDirty();
         }
 
         // Let the event manager handle the event
@@ -133,43 +153,100 @@ namespace tgui
     void Gui::draw(bool resetView)
     {
         sf::View oldView = m_Window->getView();
-
-        // Reset the view when requested
-        if (resetView)
-            m_Window->setView(m_Window->getDefaultView());
+        sf::View view = resetView ? m_Window->getDefaultView() : oldView;
 
         // Update the time
-        if (m_Focused)
-            updateTime(m_Clock.restart());
-        else
-            m_Clock.restart();
+        updateTime();
 
-        // Check if clipping is enabled
-        GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
-        GLint scissor[4];
+        if (m_FrameCacheEnabled)
+        {
+            // Only draw the widgets on the texture again when something changed since the previous frame
+            if (m_Container.m_NeedsRedraw || (m_FrameCache.getSize() != m_Window->getSize()) || !isSameView(view, m_FrameCacheView))
+            {
+                if ((m_FrameCache.getSize() != m_Window->getSize()) && !m_FrameCache.create(m_Window->getSize().x, m_Window->getSize().y))
+                {
+                    TGUI_OUTPUT("TGUI error: Failed to create the texture for the frame cache, the widgets will be drawn directly.");
+                    m_FrameCacheEnabled = false;
+                }
+                else
+                {
+                    m_FrameCacheView = view;
+                    m_FrameCache.setView(view);
+                    m_FrameCache.setActive(true);
+                    m_FrameCache.clear(sf::Color::Transparent);
+                    drawWidgets(m_FrameCache);
+                    m_FrameCache.display();
+                }
+            }
+        }
 
-        if (clippingEnabled)
+        if (m_FrameCacheEnabled)
         {
-            // Remember the old clipping area
-            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+            // The texture has the size of the window, so draw it without any scaling
+            sf::Vector2f windowSize = sf::Vector2f(m_Window->getSize());
+            m_Window->setView(sf::View(sf::FloatRect(0, 0, windowSize.x, windowSize.y)));
+            m_Window->draw(sf::Sprite(m_FrameCache.getTexture()));
         }
-        else // Clipping was disabled
+        else
         {
-            // Enable clipping
-            glEnable(GL_SCISSOR_TEST);
-            glScissor(0, 0, m_Window->getSize().x, m_Window->getSize().y);
+            m_Window->setView(view);
+            drawWidgets(*m_Window);
         }
 
-        // Draw the window with all widgets inside it
-        m_Container.drawWidgetContainer(m_Window, sf::RenderStates::Default);
+        m_Window->setView(oldView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        return m_Container.m_NeedsRedraw;
+    }
 
-        // Reset clipping to its original state
-        if (clippingEnabled)
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::updateTime()
+    {
+        // The animated widgets don't change while the window isn't focused
+        if (m_Focused)
+            updateTime(m_Clock.restart());
         else
-            glDisable(GL_SCISSOR_TEST);
+            m_Clock.restart();
+    }
 
-        m_Window->setView(oldView);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getTimeUntilUpdate() const
+    {
+        // The time of the widgets isn't updated while the window isn't focused
+        if (!m_Focused)
+            return Widget::NoDeadline;
+
+        const sf::Time time = m_Container.getTimeUntilUpdate();
+        if (time == Widget::NoDeadline)
+            return time;
+
+        // Part of the time has already passed since the widgets were last updated
+        const sf::Time elapsed = m_Clock.getElapsedTime();
+        if (time > elapsed)
+            return time - elapsed;
+        else
+            return sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawWidgets(sf::RenderTarget& target)
+    {
+        // The widgets can draw on the whole target, until they limit the area themselves
+        m_ClipStack.begin(target);
+        m_Container.m_ClipStack = &m_ClipStack;
+
+        // Draw the window with all widgets inside it
+        m_Container.drawWidgetContainer(&target, sf::RenderStates::Default);
+
+        m_Container.m_ClipStack = nullptr;
+        m_ClipStack.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -263,6 +340,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Widget::Ptr> Gui::copy(const Widget::Ptr& oldWidget, const std::vector<sf::String>& newWidgetNames)
+    {
+        return m_Container.copy(oldWidget, newWidgetNames);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::remove(const Widget::Ptr& widget)
     {
         m_Container.remove(widget);
@@ -340,6 +424,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::enableSpatialIndex(float cellSize)
+    {
+        m_Container.enableSpatialIndex(cellSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::disableSpatialIndex()
+    {
+        m_Container.disableSpatialIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::enableFrameCache()
+    {
+        // The texture may still contain an old frame
+        m_FrameCacheEnabled = true;
+        m_Container.markDirty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::disableFrameCache()
+    {
+        m_FrameCacheEnabled = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::bindGlobalCallback(std::function<void(const Callback&)> func)
     {
         m_Container.bindGlobalCallback(func);
@@ -368,6 +482,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Gui::saveWidgetsToBinaryFile(const std::string& filename)
+    {
+        return m_Container.saveWidgetsToBinaryFile(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
         m_Container.m_AnimationTimeElapsed = elapsedTime;
@@ -30,6 +30,43 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the knob
+    enum KnobProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Minimum,
+        Property_Maximum,
+        Property_Value,
+        Property_StartRotation,
+        Property_EndRotation,
+        Property_ClockwiseTurning,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getKnobProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",       "string", Property_ConfigFile},
+            {"Minimum",          "int",    Property_Minimum},
+            {"Maximum",          "int",    Property_Maximum},
+            {"Value",            "int",    Property_Value},
+            {"StartRotation",    "float",  Property_StartRotation},
+            {"EndRotation",      "float",  Property_EndRotation},
+            {"ClockwiseTurning", "bool",   Property_ClockwiseTurning},
+            {"Callback",         "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     const float pi = 3.14159265358979f;
@@ -116,6 +153,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // If the knob was loaded before then remove the old textures first
         if (m_backgroundTexture.data != nullptr)  TGUI_TextureManager.removeTexture(m_backgroundTexture);
@@ -212,6 +250,8 @@ namespace tgui
         m_backgroundTexture.sprite.setPosition(x, y);
         m_foregroundTexture.sprite.setPosition(x + (m_backgroundTexture.getSize().x / 2.0f),
                                                y + (m_backgroundTexture.getSize().y / 2.0f));
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,6 +262,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the new size of the knob
         m_size.x = width;
         m_size.y = height;
@@ -257,6 +299,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -272,6 +316,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -294,6 +340,8 @@ namespace tgui
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -319,6 +367,8 @@ namespace tgui
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -347,6 +397,8 @@ namespace tgui
                 addCallback();
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,6 +430,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,58 +632,67 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Knob::setProperty(std::string property, const std::string& value)
+    bool Knob::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "minimum")
-        {
-            setMinimum(atoi(value.c_str()));
-        }
-        else if (property == "maximum")
-        {
-            setMaximum(atoi(value.c_str()));
-        }
-        else if (property == "value")
-        {
-            setValue(atoi(value.c_str()));
-        }
-        else if (property == "startrotation")
+        switch (getKnobProperties().find(property))
         {
-            m_startRotation = static_cast<float>(atof(value.c_str()));
-        }
-        else if (property == "endrotation")
-        {
-            m_endRotation = static_cast<float>(atof(value.c_str()));
-        }
-        else if (property == "clockwiseturning")
-        {
-            if ((value == "true") || (value == "True"))
-                setClockwiseTurning(true);
-            else if ((value == "false") || (value == "False"))
-                setClockwiseTurning(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'ClockwiseTurning' property.");
-        }
-        else if (property == "callback")
-        {
-            Widget::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Minimum:
+            {
+                setMinimum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Maximum:
+            {
+                setMaximum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Value:
+            {
+                setValue(atoi(value.c_str()));
+                break;
+            }
+            case Property_StartRotation:
+            {
+                m_startRotation = static_cast<float>(atof(value.c_str()));
+                break;
+            }
+            case Property_EndRotation:
+            {
+                m_endRotation = static_cast<float>(atof(value.c_str()));
+                break;
+            }
+            case Property_ClockwiseTurning:
+            {
+                if ((value == "true") || (value == "True"))
+                    setClockwiseTurning(true);
+                else if ((value == "false") || (value == "False"))
+                    setClockwiseTurning(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'ClockwiseTurning' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                Widget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "ValueChanged") || (*it == "valuechanged"))
-                    bindCallback(ValueChanged);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ValueChanged") || (*it == "valuechanged"))
+                        bindCallback(ValueChanged);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -637,43 +700,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Knob::getProperty(std::string property, std::string& value) const
+    bool Knob::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "minimum")
-            value = to_string(getMinimum());
-        else if (property == "maximum")
-            value = to_string(getMaximum());
-        else if (property == "value")
-            value = to_string(getValue());
-        else if (property == "startrotation")
-            value = to_string(m_startRotation);
-        else if (property == "endrotation")
-            value = to_string(m_endRotation);
-        else if (property == "clockwiseturning")
-            value = m_clockwiseTurning ? "true" : "false";
-        else if (property == "callback")
+        switch (getKnobProperties().find(property))
         {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Minimum:
+                value = to_string(getMinimum());
+                break;
+            case Property_Maximum:
+                value = to_string(getMaximum());
+                break;
+            case Property_Value:
+                value = to_string(getValue());
+                break;
+            case Property_StartRotation:
+                value = to_string(m_startRotation);
+                break;
+            case Property_EndRotation:
+                value = to_string(m_endRotation);
+                break;
+            case Property_ClockwiseTurning:
+                value = m_clockwiseTurning ? "true" : "false";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
-                callbacks.push_back("ValueChanged");
+                if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+                    callbacks.push_back("ValueChanged");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -684,13 +756,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Knob::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Minimum", "int"));
-        list.push_back(std::pair<std::string, std::string>("Maximum", "int"));
-        list.push_back(std::pair<std::string, std::string>("Value", "int"));
-        list.push_back(std::pair<std::string, std::string>("StartRotation", "float"));
-        list.push_back(std::pair<std::string, std::string>("EndRotation", "float"));
-        list.push_back(std::pair<std::string, std::string>("ClockwiseTurning", "bool"));
+        getKnobProperties().addToPropertyList(list);
         return list;
     }
 
@@ -25,13 +25,45 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Label.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the label
+    enum LabelProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Text,
+        Property_TextColor,
+        Property_TextSize,
+        Property_BackgroundColor,
+        Property_AutoSize
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getLabelProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",      "string", Property_ConfigFile},
+            {"Text",            "string", Property_Text},
+            {"TextColor",       "color",  Property_TextColor},
+            {"TextSize",        "uint",   Property_TextSize},
+            {"BackgroundColor", "color",  Property_BackgroundColor},
+            {"AutoSize",        "bool",   Property_AutoSize}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +98,8 @@ namespace tgui
         if (configFileFilename.empty())
             return true;
 
+        markDirty();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // Open the config file
@@ -128,6 +162,8 @@ namespace tgui
 
         // You are no longer auto-sizing
         m_AutoSize = false;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,6 +174,8 @@ namespace tgui
 
         m_Text.setPosition(std::floor(x - m_Text.getLocalBounds().left + 0.5f), std::floor(y - m_Text.getLocalBounds().top + 0.5f));
         m_Background.setPosition(x, y);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -154,6 +192,8 @@ namespace tgui
             m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
             m_Background.setSize(m_Size);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,6 +209,8 @@ namespace tgui
     {
         m_Text.setFont(font);
         setText(getText());
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +225,7 @@ namespace tgui
     void Label::setTextColor(const sf::Color& color)
     {
         m_Text.setColor(color);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,6 +249,8 @@ namespace tgui
             m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
             m_Background.setSize(m_Size);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +265,7 @@ namespace tgui
     void Label::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_Background.setFillColor(backgroundColor);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -241,6 +287,8 @@ namespace tgui
             m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
             m_Background.setSize(m_Size);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,43 +300,50 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Label::setProperty(std::string property, const std::string& value)
+    bool Label::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "text")
+        switch (getLabelProperties().find(property))
         {
-            std::string text;
-            decodeString(value, text);
-            setText(text);
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "backgroundcolor")
-        {
-            setBackgroundColor(extractColor(value));
-        }
-        else if (property == "autosize")
-        {
-            if ((value == "true") || (value == "True"))
-                setAutoSize(true);
-            else if ((value == "false") || (value == "False"))
-                setAutoSize(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'AutoSize' property.");
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Text:
+            {
+                std::string text;
+                decodeString(value, text);
+                setText(text);
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_BackgroundColor:
+            {
+                setBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_AutoSize:
+            {
+                if ((value == "true") || (value == "True"))
+                    setAutoSize(true);
+                else if ((value == "false") || (value == "False"))
+                    setAutoSize(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'AutoSize' property.");
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -296,24 +351,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Label::getProperty(std::string property, std::string& value) const
+    bool Label::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "text")
-            encodeString(getText(), value);
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "backgroundcolor")
-            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
-        else if (property == "autosize")
-            value = m_AutoSize ? "true" : "false";
-        else // The property didn't match
-            return ClickableWidget::getProperty(property, value);
+        switch (getLabelProperties().find(property))
+        {
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Text:
+                encodeString(getText(), value);
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_BackgroundColor:
+                value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+                break;
+            case Property_AutoSize:
+                value = m_AutoSize ? "true" : "false";
+                break;
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
+        }
 
         // You pass here when one of the properties matched
         return true;
@@ -324,12 +386,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Label::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Text", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
-        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("AutoSize", "bool"));
+        getLabelProperties().addToPropertyList(list);
         return list;
     }
 
@@ -350,32 +407,13 @@ namespace tgui
         if (m_Text.getString().isEmpty())
             return;
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         // Get the global position
         sf::Vector2f topLeftPosition = states.transform.transformPoint(getPosition() - target.getView().getCenter() + (target.getView().getSize() / 2.f));
         sf::Vector2f bottomRightPosition = states.transform.transformPoint(getPosition() + m_Size - target.getView().getCenter() + (target.getView().getSize() / 2.f));
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the object outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
 
         // Draw the background
         if (m_Background.getFillColor() != sf::Color::Transparent)
@@ -385,7 +423,7 @@ namespace tgui
         target.draw(m_Text, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        clipping.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
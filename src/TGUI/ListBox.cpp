@@ -26,14 +26,58 @@
 #include <cmath>
 #include <algorithm>
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/ListBox.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the list box
+    enum ListBoxProperty
+    {
+        Property_ConfigFile = 1,
+        Property_BackgroundColor,
+        Property_TextColor,
+        Property_SelectedBackgroundColor,
+        Property_SelectedTextColor,
+        Property_BorderColor,
+        Property_ItemHeight,
+        Property_MaximumItems,
+        Property_Borders,
+        Property_Items,
+        Property_SelectedItem,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getListBoxProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",              "string",  Property_ConfigFile},
+            {"BackgroundColor",         "color",   Property_BackgroundColor},
+            {"TextColor",               "color",   Property_TextColor},
+            {"SelectedBackgroundColor", "color",   Property_SelectedBackgroundColor},
+            {"SelectedTextColor",       "color",   Property_SelectedTextColor},
+            {"BorderColor",             "color",   Property_BorderColor},
+            {"ItemHeight",              "uint",    Property_ItemHeight},
+            {"MaximumItems",            "uint",    Property_MaximumItems},
+            {"Borders",                 "borders", Property_Borders},
+            {"Items",                   "string",  Property_Items},
+            {"SelectedItem",            "int",     Property_SelectedItem},
+            {"Callback",                "",        Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +186,7 @@ namespace tgui
         {
             delete m_Scroll;
             m_Scroll = nullptr;
+            markDirty();
         }
 
         // Open the config file
@@ -227,6 +272,7 @@ namespace tgui
                     m_Scroll->setSize(m_Scroll->getSize().x, static_cast<float>(m_Size.y));
                     m_Scroll->setLowValue(m_Size.y);
                     m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
+                    markDirty();
                 }
             }
             else
@@ -271,6 +317,8 @@ namespace tgui
             m_Scroll->setSize(m_Scroll->getSize().x, static_cast<float>(m_Size.y));
             m_Scroll->setLowValue(m_Size.y);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -306,6 +354,7 @@ namespace tgui
     void ListBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -313,6 +362,7 @@ namespace tgui
     void ListBox::setTextColor(const sf::Color& textColor)
     {
         m_TextColor = textColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -320,6 +370,7 @@ namespace tgui
     void ListBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
         m_SelectedBackgroundColor = selectedBackgroundColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -327,6 +378,7 @@ namespace tgui
     void ListBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
         m_SelectedTextColor = selectedTextColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,6 +386,7 @@ namespace tgui
     void ListBox::setBorderColor(const sf::Color& borderColor)
     {
         m_BorderColor = borderColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -376,6 +429,7 @@ namespace tgui
     void ListBox::setTextFont(const sf::Font& font)
     {
         m_TextFont = &font;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -410,6 +464,8 @@ namespace tgui
             if (m_Scroll != nullptr)
                 m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
 
+            markDirty();
+
             // Return the item index
             return m_Items.size() - 1;
         }
@@ -429,6 +485,7 @@ namespace tgui
             {
                 // Select the item
                 m_SelectedItem = static_cast<int>(i);
+                markDirty();
                 return true;
             }
         }
@@ -437,6 +494,7 @@ namespace tgui
 
         // No match was found
         m_SelectedItem = -1;
+        markDirty();
         return false;
     }
 
@@ -455,11 +513,13 @@ namespace tgui
         {
             TGUI_OUTPUT("TGUI warning: Failed to select the item in the list box. The index was too high.");
             m_SelectedItem = -1;
+            markDirty();
             return false;
         }
 
         // Select the item
         m_SelectedItem = index;
+        markDirty();
         return true;
     }
 
@@ -468,6 +528,7 @@ namespace tgui
     void ListBox::deselectItem()
     {
         m_SelectedItem = -1;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -481,6 +542,8 @@ namespace tgui
             return false;
         }
 
+        markDirty();
+
         // Remove the item
         m_Items.erase(m_Items.begin() + index);
 
@@ -519,6 +582,7 @@ namespace tgui
                 if (m_Scroll != nullptr)
                     m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
 
+                markDirty();
                 return true;
             }
         }
@@ -540,6 +604,8 @@ namespace tgui
         // If there is a scrollbar then tell it that all item were removed
         if (m_Scroll != nullptr)
             m_Scroll->setMaximum(0);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -613,6 +679,8 @@ namespace tgui
         if (m_Scroll != nullptr)
             delete m_Scroll;
 
+        markDirty();
+
         // load the scrollbar and check if it failed
         m_Scroll = new Scrollbar();
         if(m_Scroll->load(scrollbarConfigFileFilename) == false)
@@ -652,6 +720,8 @@ namespace tgui
             // Remove the items that didn't fit inside the list box
             m_Items.erase(m_Items.begin() + m_MaxItems, m_Items.end());
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -684,6 +754,8 @@ namespace tgui
             // Set the maximum of the scrollbar
             m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -710,6 +782,8 @@ namespace tgui
             if (m_Scroll != nullptr)
                 m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -727,6 +801,8 @@ namespace tgui
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
         m_BottomBorder = bottomBorder;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -905,6 +981,9 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            // The scrollbar has no parent, so a change in its hover state has to be reported here
+            bool scrollbarHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + (m_Size.x - m_Scroll->getSize().x), getPosition().y);
 
@@ -921,6 +1000,9 @@ namespace tgui
                     m_Scroll->mouseMoved(x, y);
             }
 
+            if (m_Scroll->m_MouseHover != scrollbarHover)
+                markDirty();
+
             // Reset the position
             m_Scroll->setPosition(0, 0);
         }
@@ -980,79 +1062,92 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ListBox::setProperty(std::string property, const std::string& value)
+    bool ListBox::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "backgroundcolor")
-        {
-            setBackgroundColor(extractColor(value));
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            setSelectedBackgroundColor(extractColor(value));
-        }
-        else if (property == "selectedtextcolor")
+        switch (getListBoxProperties().find(property))
         {
-            setSelectedTextColor(extractColor(value));
-        }
-        else if (property == "bordercolor")
-        {
-            setBorderColor(extractColor(value));
-        }
-        else if (property == "itemheight")
-        {
-            setItemHeight(atoi(value.c_str()));
-        }
-        else if (property == "maximumitems")
-        {
-            setMaximumItems(atoi(value.c_str()));
-        }
-        else if (property == "borders")
-        {
-            Borders borders;
-            if (extractBorders(value, borders))
-                setBorders(borders.left, borders.top, borders.right, borders.bottom);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
-        }
-        else if (property == "items")
-        {
-            removeAllItems();
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_BackgroundColor:
+            {
+                setBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedBackgroundColor:
+            {
+                setSelectedBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedTextColor:
+            {
+                setSelectedTextColor(extractColor(value));
+                break;
+            }
+            case Property_BorderColor:
+            {
+                setBorderColor(extractColor(value));
+                break;
+            }
+            case Property_ItemHeight:
+            {
+                setItemHeight(atoi(value.c_str()));
+                break;
+            }
+            case Property_MaximumItems:
+            {
+                setMaximumItems(atoi(value.c_str()));
+                break;
+            }
+            case Property_Borders:
+            {
+                Borders borders;
+                if (extractBorders(value, borders))
+                    setBorders(borders.left, borders.top, borders.right, borders.bottom);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
+                break;
+            }
+            case Property_Items:
+            {
+                removeAllItems();
 
-            std::vector<sf::String> items;
-            decodeList(value, items);
+                std::vector<sf::String> items;
+                decodeList(value, items);
 
-            for (auto it = items.cbegin(); it != items.cend(); ++it)
-                addItem(*it);
-        }
-        else if (property == "selecteditem")
-        {
-            setSelectedItem(atoi(value.c_str()));
-        }
-        else if (property == "callback")
-        {
-            Widget::setProperty(property, value);
+                for (auto it = items.cbegin(); it != items.cend(); ++it)
+                    addItem(*it);
+                break;
+            }
+            case Property_SelectedItem:
+            {
+                setSelectedItem(atoi(value.c_str()));
+                break;
+            }
+            case Property_Callback:
+            {
+                Widget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "ItemSelected") || (*it == "itemselected"))
-                    bindCallback(ItemSelected);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ItemSelected") || (*it == "itemselected"))
+                        bindCallback(ItemSelected);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1060,53 +1155,66 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ListBox::getProperty(std::string property, std::string& value) const
+    bool ListBox::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "backgroundcolor")
-            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "selectedbackgroundcolor")
-            value = "(" + to_string(int(getSelectedBackgroundColor().r)) + "," + to_string(int(getSelectedBackgroundColor().g))
-                    + "," + to_string(int(getSelectedBackgroundColor().b)) + "," + to_string(int(getSelectedBackgroundColor().a)) + ")";
-        else if (property == "selectedtextcolor")
-            value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
-                    + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
-        else if (property == "bordercolor")
-            value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
-        else if (property == "itemheight")
-            value = to_string(getItemHeight());
-        else if (property == "maximumitems")
-            value = to_string(getMaximumItems());
-        else if (property == "borders")
-            value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
-        else if (property == "items")
-            encodeList(m_Items, value);
-        else if (property == "selecteditem")
-            value = to_string(getSelectedItemIndex());
-        else if (property == "callback")
+        switch (getListBoxProperties().find(property))
         {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_BackgroundColor:
+                value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_SelectedBackgroundColor:
+                value = "(" + to_string(int(getSelectedBackgroundColor().r)) + "," + to_string(int(getSelectedBackgroundColor().g))
+                        + "," + to_string(int(getSelectedBackgroundColor().b)) + "," + to_string(int(getSelectedBackgroundColor().a)) + ")";
+                break;
+            case Property_SelectedTextColor:
+                value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
+                        + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
+                break;
+            case Property_BorderColor:
+                value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
+                break;
+            case Property_ItemHeight:
+                value = to_string(getItemHeight());
+                break;
+            case Property_MaximumItems:
+                value = to_string(getMaximumItems());
+                break;
+            case Property_Borders:
+                value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
+                break;
+            case Property_Items:
+                encodeList(m_Items, value);
+                break;
+            case Property_SelectedItem:
+                value = to_string(getSelectedItemIndex());
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ItemSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ItemSelected).size() == 1) && (m_CallbackFunctions.at(ItemSelected).front() == nullptr))
-                callbacks.push_back("ItemSelected");
+                if ((m_CallbackFunctions.find(ItemSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ItemSelected).size() == 1) && (m_CallbackFunctions.at(ItemSelected).front() == nullptr))
+                    callbacks.push_back("ItemSelected");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty() || tempValue.empty())
-                value += tempValue;
-            else
-                value += "," + tempValue;
+                if (value.empty() || tempValue.empty())
+                    value += tempValue;
+                else
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1117,17 +1225,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > ListBox::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedBackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedTextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("BorderColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("ItemHeight", "uint"));
-        list.push_back(std::pair<std::string, std::string>("MaximumItems", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Borders", "borders"));
-        list.push_back(std::pair<std::string, std::string>("Items", "string"));
-        list.push_back(std::pair<std::string, std::string>("SelectedItem", "int"));
+        getListBoxProperties().addToPropertyList(list);
         return list;
     }
 
@@ -1143,10 +1241,6 @@ namespace tgui
 
     void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         // Get the global position
         sf::Vector2f topLeftPosition;
         sf::Vector2f bottomRightPosition;
@@ -1171,49 +1265,16 @@ namespace tgui
         sf::Transform oldTransform = states.transform;
 
         // Draw the borders
-        {
-            // Draw left border
-            sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y + m_TopBorder)));
-            border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
-            border.setFillColor(m_BorderColor);
-            target.draw(border, states);
-
-            // Draw top border
-            border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_RightBorder), static_cast<float>(m_TopBorder)));
-            border.setPosition(0, -static_cast<float>(m_TopBorder));
-            target.draw(border, states);
-
-            // Draw right border
-            border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y + m_BottomBorder)));
-            border.setPosition(static_cast<float>(m_Size.x), 0);
-            target.draw(border, states);
-
-            // Draw bottom border
-            border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_LeftBorder), static_cast<float>(m_BottomBorder)));
-            border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y));
-            target.draw(border, states);
-        }
+        drawBorders(target, states, sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)), m_BorderColor);
 
         // Draw the background
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)));
         front.setFillColor(m_BackgroundColor);
         target.draw(front, states);
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        // Set the clipping area
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
 
         // Create a text widget to draw the items
         sf::Text text("", *m_TextFont, m_TextSize);
@@ -1232,9 +1293,6 @@ namespace tgui
             if ((m_Scroll->getValue() + m_Scroll->getLowValue()) % m_ItemHeight != 0)
                 ++lastItem;
 
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
             for (unsigned int i = firstItem; i < lastItem; ++i)
             {
                 // Restore the transformations
@@ -1278,9 +1336,6 @@ namespace tgui
         }
         else // There is no scrollbar or it is invisible
         {
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
             // Store the current transformations
             sf::Transform storedTransform = states.transform;
 
@@ -1327,7 +1382,7 @@ namespace tgui
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        clipping.end();
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -30,6 +30,43 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the loading bar
+    enum LoadingBarProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Minimum,
+        Property_Maximum,
+        Property_Value,
+        Property_Text,
+        Property_TextColor,
+        Property_TextSize,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getLoadingBarProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile", "string", Property_ConfigFile},
+            {"Minimum",    "uint",   Property_Minimum},
+            {"Maximum",    "uint",   Property_Maximum},
+            {"Value",      "uint",   Property_Value},
+            {"Text",       "string", Property_Text},
+            {"TextColor",  "color",  Property_TextColor},
+            {"TextSize",   "uint",   Property_TextSize},
+            {"Callback",   "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,6 +160,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // Remove all textures if they were loaded before
         if (m_TextureBack_L.data != nullptr)  TGUI_TextureManager.removeTexture(m_TextureBack_L);
@@ -254,8 +292,8 @@ namespace tgui
                 m_Size.x = static_cast<float>(m_TextureBack_L.getSize().x + m_TextureBack_M.getSize().x + m_TextureBack_R.getSize().x);
                 m_Size.y = static_cast<float>(m_TextureBack_M.getSize().y);
 
-                m_TextureBack_M.data->texture.setRepeated(true);
-                m_TextureFront_M.data->texture.setRepeated(true);
+                m_TextureBack_M.setRepeated(true);
+                m_TextureFront_M.setRepeated(true);
             }
             else
             {
@@ -301,6 +339,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -340,6 +380,8 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -359,6 +401,8 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -376,6 +420,8 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,6 +455,8 @@ namespace tgui
 
             // Recalculate the size of the front image (the size of the part that will be drawn)
             recalculateSize();
+
+            markDirty();
         }
 
         // return the new value
@@ -444,6 +492,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the new text
         m_Text.setString(text);
 
@@ -482,6 +532,7 @@ namespace tgui
     void LoadingBar::setTextFont(const sf::Font& font)
     {
         m_Text.setFont(font);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -496,6 +547,7 @@ namespace tgui
     void LoadingBar::setTextColor(const sf::Color& color)
     {
         m_Text.setColor(color);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -514,6 +566,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text.getString());
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -539,55 +593,64 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool LoadingBar::setProperty(std::string property, const std::string& value)
+    bool LoadingBar::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "minimum")
+        switch (getLoadingBarProperties().find(property))
         {
-            setMinimum(atoi(value.c_str()));
-        }
-        else if (property == "maximum")
-        {
-            setMaximum(atoi(value.c_str()));
-        }
-        else if (property == "value")
-        {
-            setValue(atoi(value.c_str()));
-        }
-        else if (property == "text")
-        {
-            setText(value);
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "callback")
-        {
-            ClickableWidget::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Minimum:
+            {
+                setMinimum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Maximum:
+            {
+                setMaximum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Value:
+            {
+                setValue(atoi(value.c_str()));
+                break;
+            }
+            case Property_Text:
+            {
+                setText(value);
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_Callback:
+            {
+                ClickableWidget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "ValueChanged") || (*it == "valuechanged"))
-                    bindCallback(ValueChanged);
-                else if ((*it == "LoadingBarFull") || (*it == "loadingbarfull"))
-                    bindCallback(LoadingBarFull);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ValueChanged") || (*it == "valuechanged"))
+                        bindCallback(ValueChanged);
+                    else if ((*it == "LoadingBarFull") || (*it == "loadingbarfull"))
+                        bindCallback(LoadingBarFull);
+                }
+                break;
             }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -595,45 +658,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool LoadingBar::getProperty(std::string property, std::string& value) const
+    bool LoadingBar::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "minimum")
-            value = to_string(getMinimum());
-        else if (property == "maximum")
-            value = to_string(getMaximum());
-        else if (property == "value")
-            value = to_string(getValue());
-        else if (property == "text")
-            value = getText().toAnsiString();
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "callback")
+        switch (getLoadingBarProperties().find(property))
         {
-            std::string tempValue;
-            ClickableWidget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Minimum:
+                value = to_string(getMinimum());
+                break;
+            case Property_Maximum:
+                value = to_string(getMaximum());
+                break;
+            case Property_Value:
+                value = to_string(getValue());
+                break;
+            case Property_Text:
+                value = getText().toAnsiString();
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                ClickableWidget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
-                callbacks.push_back("ValueChanged");
-            if ((m_CallbackFunctions.find(LoadingBarFull) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LoadingBarFull).size() == 1) && (m_CallbackFunctions.at(LoadingBarFull).front() == nullptr))
-                callbacks.push_back("LoadingBarFull");
+                if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+                    callbacks.push_back("ValueChanged");
+                if ((m_CallbackFunctions.find(LoadingBarFull) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LoadingBarFull).size() == 1) && (m_CallbackFunctions.at(LoadingBarFull).front() == nullptr))
+                    callbacks.push_back("LoadingBarFull");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -644,13 +716,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > LoadingBar::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Minimum", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Maximum", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Value", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Text", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
+        getLoadingBarProperties().addToPropertyList(list);
         return list;
     }
 
@@ -668,9 +734,9 @@ namespace tgui
             float totalWidth = m_Size.x / (m_Size.y / m_TextureBack_M.getSize().y);
 
             // Get the bounds of the sprites
-            sf::IntRect bounds_L = m_TextureFront_L.sprite.getTextureRect();
-            sf::IntRect bounds_M = m_TextureFront_M.sprite.getTextureRect();
-            sf::IntRect bounds_R = m_TextureFront_R.sprite.getTextureRect();
+            sf::IntRect bounds_L = m_TextureFront_L.getTextureRect();
+            sf::IntRect bounds_M = m_TextureFront_M.getTextureRect();
+            sf::IntRect bounds_R = m_TextureFront_R.getTextureRect();
 
             // Calculate the size of the part to display
             float frontSize;
@@ -718,17 +784,17 @@ namespace tgui
                 bounds_R.width = 0;
             }
 
-            m_TextureFront_L.sprite.setTextureRect(bounds_L);
-            m_TextureFront_M.sprite.setTextureRect(bounds_M);
-            m_TextureFront_R.sprite.setTextureRect(bounds_R);
+            m_TextureFront_L.setTextureRect(bounds_L);
+            m_TextureFront_M.setTextureRect(bounds_M);
+            m_TextureFront_R.setTextureRect(bounds_R);
 
             // Make sure that the back image is displayed correctly
-            m_TextureBack_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(totalWidth - m_TextureBack_L.getSize().x - m_TextureBack_R.getSize().x), m_TextureBack_M.getSize().y));
+            m_TextureBack_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(totalWidth - m_TextureBack_L.getSize().x - m_TextureBack_R.getSize().x), m_TextureBack_M.getSize().y));
         }
         else // The image is not split
         {
             // Calculate the size of the front sprite
-            sf::IntRect frontBounds(m_TextureFront_M.sprite.getTextureRect());
+            sf::IntRect frontBounds(m_TextureFront_M.getTextureRect());
 
             // Only change the width when not dividing by zero
             if ((m_Maximum - m_Minimum) > 0)
@@ -737,7 +803,7 @@ namespace tgui
                 frontBounds.width = static_cast<int>(m_TextureBack_M.getSize().x);
 
             // Set the size of the front image
-            m_TextureFront_M.sprite.setTextureRect(frontBounds);
+            m_TextureFront_M.setTextureRect(frontBounds);
         }
     }
 
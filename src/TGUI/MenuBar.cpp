@@ -32,6 +32,47 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the menu bar
+    enum MenuBarProperty
+    {
+        Property_ConfigFile = 1,
+        Property_BackgroundColor,
+        Property_TextColor,
+        Property_SelectedBackgroundColor,
+        Property_SelectedTextColor,
+        Property_TextSize,
+        Property_DistanceToSide,
+        Property_MinimumSubMenuWidth,
+        Property_menus,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getMenuBarProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",              "string", Property_ConfigFile},
+            {"BackgroundColor",         "color",  Property_BackgroundColor},
+            {"TextColor",               "color",  Property_TextColor},
+            {"SelectedBackgroundColor", "color",  Property_SelectedBackgroundColor},
+            {"SelectedTextColor",       "color",  Property_SelectedTextColor},
+            {"TextSize",                "uint",   Property_TextSize},
+            {"DistanceToSide",          "uint",   Property_DistanceToSide},
+            {"MinimumSubMenuWidth",     "uint",   Property_MinimumSubMenuWidth},
+            {"menus",                   "string", Property_menus},
+            {"Callback",                "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +177,8 @@ namespace tgui
             m_Size.y = 10;
 
         setTextSize(static_cast<unsigned int>(height * 0.85f));
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +203,8 @@ namespace tgui
         menu.text.setCharacterSize(static_cast<unsigned int>(menu.text.getCharacterSize() - menu.text.getLocalBounds().top));
 
         m_Menus.push_back(menu);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +225,7 @@ namespace tgui
                 menuItem.setCharacterSize(static_cast<unsigned int>(menuItem.getCharacterSize() - menuItem.getLocalBounds().top));
 
                 m_Menus[i].menuItems.push_back(menuItem);
+                markDirty();
                 return true;
             }
         }
@@ -204,6 +250,7 @@ namespace tgui
                 if (m_VisibleMenu == static_cast<int>(i))
                     m_VisibleMenu = -1;
 
+                markDirty();
                 return true;
             }
         }
@@ -233,6 +280,7 @@ namespace tgui
                         if (m_Menus[i].selectedMenuItem == static_cast<int>(j))
                             m_Menus[i].selectedMenuItem = -1;
 
+                        markDirty();
                         return true;
                     }
                 }
@@ -248,6 +296,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_Menus.clear();
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -279,6 +328,7 @@ namespace tgui
     void MenuBar::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -297,6 +347,8 @@ namespace tgui
 
             m_Menus[i].text.setColor(textColor);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -304,6 +356,7 @@ namespace tgui
     void MenuBar::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
         m_SelectedBackgroundColor = selectedBackgroundColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -317,6 +370,8 @@ namespace tgui
             if (m_Menus[m_VisibleMenu].selectedMenuItem != -1)
                 m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(selectedTextColor);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -364,6 +419,8 @@ namespace tgui
         }
 
         setTextSize(m_TextSize);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -390,6 +447,8 @@ namespace tgui
             m_Menus[i].text.setCharacterSize(m_TextSize);
             m_Menus[i].text.setCharacterSize(static_cast<unsigned int>(m_Menus[i].text.getCharacterSize() - m_Menus[i].text.getLocalBounds().top));
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -404,6 +463,7 @@ namespace tgui
     void MenuBar::setDistanceToSide(unsigned int distanceToSide)
     {
         m_DistanceToSide = distanceToSide;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,6 +478,7 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(unsigned int minimumWidth)
     {
         m_MinimumSubMenuWidth = minimumWidth;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,6 +637,7 @@ namespace tgui
                             {
                                 m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(m_TextColor);
                                 m_Menus[m_VisibleMenu].selectedMenuItem = -1;
+                                markDirty();
                             }
                         }
                         else // The menu isn't open yet
@@ -596,6 +658,8 @@ namespace tgui
                             // If this menu can be opened then do so
                             if (!m_Menus[i].menuItems.empty())
                                 m_VisibleMenu = static_cast<int>(i);
+
+                            markDirty();
                         }
                         break;
                     }
@@ -617,6 +681,7 @@ namespace tgui
                 // Mark the item below the mouse as selected
                 m_Menus[m_VisibleMenu].selectedMenuItem = selectedMenuItem;
                 m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(m_SelectedTextColor);
+                markDirty();
             }
         }
     }
@@ -641,83 +706,94 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool MenuBar::setProperty(std::string property, const std::string& value)
+    bool MenuBar::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
+        switch (getMenuBarProperties().find(property))
         {
-            load(value);
-        }
-        else if (property == "backgroundcolor")
-        {
-            setBackgroundColor(extractColor(value));
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            setSelectedBackgroundColor(extractColor(value));
-        }
-        else if (property == "selectedtextcolor")
-        {
-            setSelectedTextColor(extractColor(value));
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "distancetoside")
-        {
-            setDistanceToSide(atoi(value.c_str()));
-        }
-        else if (property == "minimumsubmenuwidth")
-        {
-            setMinimumSubMenuWidth(atoi(value.c_str()));
-        }
-        else if (property == "menus")
-        {
-            removeAllMenus();
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_BackgroundColor:
+            {
+                setBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedBackgroundColor:
+            {
+                setSelectedBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedTextColor:
+            {
+                setSelectedTextColor(extractColor(value));
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_DistanceToSide:
+            {
+                setDistanceToSide(atoi(value.c_str()));
+                break;
+            }
+            case Property_MinimumSubMenuWidth:
+            {
+                setMinimumSubMenuWidth(atoi(value.c_str()));
+                break;
+            }
+            case Property_menus:
+            {
+                removeAllMenus();
 
-            std::vector<sf::String> menus;
-            decodeList(value, menus);
+                std::vector<sf::String> menus;
+                decodeList(value, menus);
 
-            for (auto menuIt = menus.begin(); menuIt != menus.end(); ++menuIt)
-            {
-                std::string::size_type commaPos = menuIt->find(',');
-                if (commaPos != std::string::npos)
+                for (auto menuIt = menus.begin(); menuIt != menus.end(); ++menuIt)
                 {
-                    std::vector<sf::String> menuItems;
-                    std::string menu = menuIt->toAnsiString().substr(0, commaPos);
-                    menuIt->erase(0, commaPos + 1);
+                    std::string::size_type commaPos = menuIt->find(',');
+                    if (commaPos != std::string::npos)
+                    {
+                        std::vector<sf::String> menuItems;
+                        std::string menu = menuIt->toAnsiString().substr(0, commaPos);
+                        menuIt->erase(0, commaPos + 1);
 
-                   addMenu(menu);
-                   decodeList(*menuIt, menuItems);
+                       addMenu(menu);
+                       decodeList(*menuIt, menuItems);
 
-                   for (auto menuItemIt = menuItems.cbegin(); menuItemIt != menuItems.cend(); ++menuItemIt)
-                        addMenuItem(menu, *menuItemIt);
+                       for (auto menuItemIt = menuItems.cbegin(); menuItemIt != menuItems.cend(); ++menuItemIt)
+                            addMenuItem(menu, *menuItemIt);
+                    }
+                    else // No comma found
+                        addMenu(*menuIt);
                 }
-                else // No comma found
-                    addMenu(*menuIt);
+                break;
             }
-        }
-        else if (property == "callback")
-        {
-            Widget::setProperty(property, value);
+            case Property_Callback:
+            {
+                Widget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "MenuItemClicked") || (*it == "menuitemclicked"))
-                    bindCallback(MenuItemClicked);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "MenuItemClicked") || (*it == "menuitemclicked"))
+                        bindCallback(MenuItemClicked);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -725,67 +801,78 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool MenuBar::getProperty(std::string property, std::string& value) const
+    bool MenuBar::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "backgroundcolor")
-            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "selectedbackgroundcolor")
-            value = "(" + to_string(int(getSelectedBackgroundColor().r)) + "," + to_string(int(getSelectedBackgroundColor().g))
-                    + "," + to_string(int(getSelectedBackgroundColor().b)) + "," + to_string(int(getSelectedBackgroundColor().a)) + ")";
-        else if (property == "selectedtextcolor")
-            value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
-                    + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "distancetoside")
-            value = to_string(getDistanceToSide());
-        else if (property == "minimumsubmenuwidth")
-            value = to_string(getMinimumSubMenuWidth());
-        else if (property == "menus")
+        switch (getMenuBarProperties().find(property))
         {
-            std::vector<sf::String> menusList;
-
-            for (auto menuIt = m_Menus.cbegin(); menuIt != m_Menus.cend(); ++menuIt)
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_BackgroundColor:
+                value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_SelectedBackgroundColor:
+                value = "(" + to_string(int(getSelectedBackgroundColor().r)) + "," + to_string(int(getSelectedBackgroundColor().g))
+                        + "," + to_string(int(getSelectedBackgroundColor().b)) + "," + to_string(int(getSelectedBackgroundColor().a)) + ")";
+                break;
+            case Property_SelectedTextColor:
+                value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
+                        + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_DistanceToSide:
+                value = to_string(getDistanceToSide());
+                break;
+            case Property_MinimumSubMenuWidth:
+                value = to_string(getMinimumSubMenuWidth());
+                break;
+            case Property_menus:
             {
-                std::vector<sf::String> menuItemsList;
-                menuItemsList.push_back(menuIt->text.getString());
+                std::vector<sf::String> menusList;
 
-                for (auto menuItemIt = menuIt->menuItems.cbegin(); menuItemIt != menuIt->menuItems.cend(); ++menuItemIt)
-                    menuItemsList.push_back(menuItemIt->getString());
+                for (auto menuIt = m_Menus.cbegin(); menuIt != m_Menus.cend(); ++menuIt)
+                {
+                    std::vector<sf::String> menuItemsList;
+                    menuItemsList.push_back(menuIt->text.getString());
 
-                std::string menuItemsString;
-                encodeList(menuItemsList, menuItemsString);
+                    for (auto menuItemIt = menuIt->menuItems.cbegin(); menuItemIt != menuIt->menuItems.cend(); ++menuItemIt)
+                        menuItemsList.push_back(menuItemIt->getString());
 
-                menusList.push_back(menuItemsString);
-            }
+                    std::string menuItemsString;
+                    encodeList(menuItemsList, menuItemsString);
 
-            encodeList(menusList, value);
-        }
-        else if (property == "callback")
-        {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+                    menusList.push_back(menuItemsString);
+                }
 
-            std::vector<sf::String> callbacks;
+                encodeList(menusList, value);
+                break;
+            }
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            if ((m_CallbackFunctions.find(MenuItemClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MenuItemClicked).size() == 1) && (m_CallbackFunctions.at(MenuItemClicked).front() == nullptr))
-                callbacks.push_back("MenuItemClicked");
+                std::vector<sf::String> callbacks;
 
-            encodeList(callbacks, value);
+                if ((m_CallbackFunctions.find(MenuItemClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MenuItemClicked).size() == 1) && (m_CallbackFunctions.at(MenuItemClicked).front() == nullptr))
+                    callbacks.push_back("MenuItemClicked");
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                encodeList(callbacks, value);
+
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -796,15 +883,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > MenuBar::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedBackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedTextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
-        list.push_back(std::pair<std::string, std::string>("DistanceToSide", "uint"));
-        list.push_back(std::pair<std::string, std::string>("MinimumSubMenuWidth", "uint"));
-        list.push_back(std::pair<std::string, std::string>("menus", "string"));
+        getMenuBarProperties().addToPropertyList(list);
         return list;
     }
 
@@ -28,6 +28,37 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the message box
+    enum MessageBoxProperty
+    {
+        Property_Text = 1,
+        Property_TextColor,
+        Property_TextSize,
+        Property_Buttons,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getMessageBoxProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"Text",      "string", Property_Text},
+            {"TextColor", "color",  Property_TextColor},
+            {"TextSize",  "uint",   Property_TextSize},
+            {"Buttons",   "string", Property_Buttons},
+            {"Callback",  "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,6 +132,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // Open the config file
         ConfigFile configFile;
@@ -201,6 +233,8 @@ namespace tgui
         {
             TGUI_OUTPUT("TGUI error: Failed to set the text. MessageBox was not loaded completely.");
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,6 +255,7 @@ namespace tgui
     void MessageBox::setTextFont(const sf::Font& font)
     {
         m_Label->setTextFont(font);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,6 +270,7 @@ namespace tgui
     void MessageBox::setTextColor(const sf::Color& color)
     {
         m_Label->setTextColor(color);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,6 +295,8 @@ namespace tgui
 
             rearrange();
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -288,53 +326,61 @@ namespace tgui
         {
             TGUI_OUTPUT("TGUI error: Could not add a button. MessageBox was not loaded completely.");
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool MessageBox::setProperty(std::string property, const std::string& value)
+    bool MessageBox::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "text")
-        {
-            setText(value);
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "buttons")
+        switch (getMessageBoxProperties().find(property))
         {
-            removeAllWidgets();
-            m_Buttons.clear();
-            add(m_Label);
+            case Property_Text:
+            {
+                setText(value);
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_Buttons:
+            {
+                removeAllWidgets();
+                m_Buttons.clear();
+                add(m_Label);
 
-            std::vector<sf::String> buttons;
-            decodeList(value, buttons);
+                std::vector<sf::String> buttons;
+                decodeList(value, buttons);
 
-            for (auto it = buttons.cbegin(); it != buttons.cend(); ++it)
-                addButton(*it);
-        }
-        else if (property == "callback")
-        {
-            ChildWindow::setProperty(property, value);
+                for (auto it = buttons.cbegin(); it != buttons.cend(); ++it)
+                    addButton(*it);
+                break;
+            }
+            case Property_Callback:
+            {
+                ChildWindow::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "ButtonClicked") || (*it == "buttonclicked"))
-                    bindCallback(ButtonClicked);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ButtonClicked") || (*it == "buttonclicked"))
+                        bindCallback(ButtonClicked);
+                }
+                break;
             }
+            default: // The property didn't match
+                return ChildWindow::setProperty(property, value);
         }
-        else // The property didn't match
-            return ChildWindow::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -342,43 +388,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool MessageBox::getProperty(std::string property, std::string& value) const
+    bool MessageBox::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "text")
-            value = getText().toAnsiString();
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "buttons")
+        switch (getMessageBoxProperties().find(property))
         {
-            std::vector<sf::String> buttons;
-            for (auto it = m_Buttons.cbegin(); it != m_Buttons.cend(); ++it)
-                buttons.push_back((*it)->getText());
+            case Property_Text:
+                value = getText().toAnsiString();
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_Buttons:
+            {
+                std::vector<sf::String> buttons;
+                for (auto it = m_Buttons.cbegin(); it != m_Buttons.cend(); ++it)
+                    buttons.push_back((*it)->getText());
 
-            encodeList(buttons, value);
-        }
-        else if (property == "callback")
-        {
-            std::string tempValue;
-            ChildWindow::getProperty(property, tempValue);
+                encodeList(buttons, value);
+                break;
+            }
+            case Property_Callback:
+            {
+                std::string tempValue;
+                ChildWindow::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ButtonClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ButtonClicked).size() == 1) && (m_CallbackFunctions.at(ButtonClicked).front() == nullptr))
-                callbacks.push_back("ButtonClicked");
+                if ((m_CallbackFunctions.find(ButtonClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ButtonClicked).size() == 1) && (m_CallbackFunctions.at(ButtonClicked).front() == nullptr))
+                    callbacks.push_back("ButtonClicked");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return ChildWindow::getProperty(property, value);
         }
-        else // The property didn't match
-            return ChildWindow::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -389,10 +441,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > MessageBox::getPropertyList() const
     {
         auto list = ChildWindow::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("Text", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Buttons", "string"));
+        getMessageBoxProperties().addToPropertyList(list);
         return list;
     }
 
@@ -23,13 +23,37 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Panel.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the panel
+    enum PanelProperty
+    {
+        Property_BackgroundColor = 1,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getPanelProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"BackgroundColor", "color", Property_BackgroundColor},
+            {"Callback",        "",      Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,6 +130,8 @@ namespace tgui
         // If there is a background texture then resize it
         if (m_Texture)
             m_Sprite.setScale(m_Size.x / m_Texture->getSize().x, m_Size.y / m_Texture->getSize().y);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -128,6 +154,8 @@ namespace tgui
             m_Sprite.setTexture(*m_Texture, true);
             m_Sprite.setScale(m_Size.x / m_Texture->getSize().x, m_Size.y / m_Texture->getSize().y);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +170,7 @@ namespace tgui
     void Panel::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -178,7 +207,10 @@ namespace tgui
 
             // Tell the widgets inside the panel that the mouse is no longer on top of them
             for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            {
+                if (m_Widgets[i] != nullptr)
+                    m_Widgets[i]->mouseNotOnWidget();
+            }
 
             m_MouseHover = false;
         }
@@ -239,33 +271,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Panel::setProperty(std::string property, const std::string& value)
+    bool Panel::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "backgroundcolor")
+        switch (getPanelProperties().find(property))
         {
-            setBackgroundColor(extractColor(value));
-        }
-        else if (property == "callback")
-        {
-            Container::setProperty(property, value);
+            case Property_BackgroundColor:
+            {
+                setBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_Callback:
+            {
+                Container::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "LeftMousePressed") || (*it == "leftmousepressed"))
-                    bindCallback(LeftMousePressed);
-                else if ((*it == "LeftMouseReleased") || (*it == "leftmousereleased"))
-                    bindCallback(LeftMouseReleased);
-                else if ((*it == "LeftMouseClicked") || (*it == "leftmouseclicked"))
-                    bindCallback(LeftMouseClicked);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "LeftMousePressed") || (*it == "leftmousepressed"))
+                        bindCallback(LeftMousePressed);
+                    else if ((*it == "LeftMouseReleased") || (*it == "leftmousereleased"))
+                        bindCallback(LeftMouseReleased);
+                    else if ((*it == "LeftMouseClicked") || (*it == "leftmouseclicked"))
+                        bindCallback(LeftMouseClicked);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Container::setProperty(property, value);
         }
-        else // The property didn't match
-            return Container::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -273,35 +308,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Panel::getProperty(std::string property, std::string& value) const
+    bool Panel::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "backgroundcolor")
-            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
-        else if (property == "callback")
+        switch (getPanelProperties().find(property))
         {
-            std::string tempValue;
-            Container::getProperty(property, tempValue);
+            case Property_BackgroundColor:
+                value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Container::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
-                callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(LeftMouseReleased) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseReleased).size() == 1) && (m_CallbackFunctions.at(LeftMouseReleased).front() == nullptr))
-                callbacks.push_back("LeftMouseReleased");
-            if ((m_CallbackFunctions.find(LeftMouseClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseClicked).size() == 1) && (m_CallbackFunctions.at(LeftMouseClicked).front() == nullptr))
-                callbacks.push_back("LeftMouseClicked");
+                if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+                    callbacks.push_back("LeftMousePressed");
+                if ((m_CallbackFunctions.find(LeftMouseReleased) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseReleased).size() == 1) && (m_CallbackFunctions.at(LeftMouseReleased).front() == nullptr))
+                    callbacks.push_back("LeftMouseReleased");
+                if ((m_CallbackFunctions.find(LeftMouseClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseClicked).size() == 1) && (m_CallbackFunctions.at(LeftMouseClicked).front() == nullptr))
+                    callbacks.push_back("LeftMouseClicked");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty() || tempValue.empty())
-                value += tempValue;
-            else
-                value += "," + tempValue;
+                if (value.empty() || tempValue.empty())
+                    value += tempValue;
+                else
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Container::getProperty(property, value);
         }
-        else // The property didn't match
-            return Container::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -312,7 +350,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Panel::getPropertyList() const
     {
         auto list = Container::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
+        getPanelProperties().addToPropertyList(list);
         return list;
     }
 
@@ -324,32 +362,13 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         // Get the global position
         sf::Vector2f topLeftPosition = states.transform.transformPoint(getPosition() - target.getView().getCenter() + (target.getView().getSize() / 2.f));
         sf::Vector2f bottomRightPosition = states.transform.transformPoint(getPosition() + m_Size - target.getView().getCenter() + (target.getView().getSize() / 2.f));
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
 
         // Set the transform
         states.transform *= getTransform();
@@ -370,7 +389,7 @@ namespace tgui
         drawWidgetContainer(&target, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        clipping.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,31 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the picture
+    enum PictureProperty
+    {
+        Property_Filename = 1,
+        Property_Smooth
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getPictureProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"Filename", "string", Property_Filename},
+            {"Smooth",   "bool",   Property_Smooth}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,6 +110,7 @@ namespace tgui
     {
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
         m_Size.x = 0;
         m_Size.y = 0;
 
@@ -126,6 +152,8 @@ namespace tgui
         Transformable::setPosition(x, y);
 
         m_Texture.sprite.setPosition(x, y);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,6 +167,8 @@ namespace tgui
             m_Texture.sprite.setScale(m_Size.x / m_Texture.getSize().x, m_Size.y / m_Texture.getSize().y);
         else
             TGUI_OUTPUT("TGUI warning: Picture::setSize called while Picture wasn't loaded yet.");
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,9 +176,11 @@ namespace tgui
     void Picture::setSmooth(bool smooth)
     {
         if (m_Loaded)
-            m_Texture.data->texture.setSmooth(smooth);
+            m_Texture.setSmooth(smooth);
         else
             TGUI_OUTPUT("TGUI warning: Picture::setSmooth called while Picture wasn't loaded yet.");
+
+        markDirty();
     }
 
 
@@ -157,7 +189,7 @@ namespace tgui
     bool Picture::isSmooth() const
     {
         if (m_Loaded)
-            return m_Texture.data->texture.isSmooth();
+            return m_Texture.isSmooth();
         else
         {
             TGUI_OUTPUT("TGUI warning: Picture::isSmooth called while Picture wasn't loaded yet.");
@@ -203,25 +235,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Picture::setProperty(std::string property, const std::string& value)
+    bool Picture::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "filename")
+        switch (getPictureProperties().find(property))
         {
-            load(value);
+            case Property_Filename:
+            {
+                load(value);
+                break;
+            }
+            case Property_Smooth:
+            {
+                if ((value == "true") || (value == "True"))
+                    setSmooth(true);
+                else if ((value == "false") || (value == "False"))
+                    setSmooth(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Smooth' property.");
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else if (property == "smooth")
-        {
-            if ((value == "true") || (value == "True"))
-                setSmooth(true);
-            else if ((value == "false") || (value == "False"))
-                setSmooth(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Smooth' property.");
-        }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -229,16 +264,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Picture::getProperty(std::string property, std::string& value) const
+    bool Picture::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "filename")
-            value = getLoadedFilename();
-        else if (property == "smooth")
-            value = isSmooth() ? "true" : "false";
-        else // The property didn't match
-            return ClickableWidget::getProperty(property, value);
+        switch (getPictureProperties().find(property))
+        {
+            case Property_Filename:
+                value = getLoadedFilename();
+                break;
+            case Property_Smooth:
+                value = isSmooth() ? "true" : "false";
+                break;
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
+        }
 
         // You pass here when one of the properties matched
         return true;
@@ -249,8 +287,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Picture::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("Filename", "string"));
-        list.push_back(std::pair<std::string, std::string>("Smooth", "bool"));
+        getPictureProperties().addToPropertyList(list);
         return list;
     }
 
@@ -0,0 +1,101 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <cctype>
+
+#include <TGUI/PropertyTable.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::PropertyTable(std::initializer_list<Property> properties) :
+    m_Properties(properties)
+    {
+        m_Ids.reserve(m_Properties.size());
+        for (auto it = m_Properties.cbegin(); it != m_Properties.cend(); ++it)
+            m_Ids[it->name] = it->id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int PropertyTable::find(const std::string& name) const
+    {
+        auto it = m_Ids.find(name);
+        if (it != m_Ids.end())
+            return it->second;
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyTable::addToPropertyList(std::list< std::pair<std::string, std::string> >& list) const
+    {
+        for (auto it = m_Properties.cbegin(); it != m_Properties.cend(); ++it)
+        {
+            if (it->type[0] != '\0')
+                list.push_back(std::pair<std::string, std::string>(it->name, it->type));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyTable::NameHash::operator()(const std::string& name) const
+    {
+        // FNV-1a hash over the lowercase characters
+        std::size_t hash = 2166136261u;
+        for (std::string::const_iterator it = name.begin(); it != name.end(); ++it)
+        {
+            hash ^= static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(*it)));
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PropertyTable::NameEqual::operator()(const std::string& left, const std::string& right) const
+    {
+        if (left.length() != right.length())
+            return false;
+
+        for (std::string::size_type i = 0; i < left.length(); ++i)
+        {
+            if (std::tolower(static_cast<unsigned char>(left[i])) != std::tolower(static_cast<unsigned char>(right[i])))
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
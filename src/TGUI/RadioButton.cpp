@@ -30,6 +30,45 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the radio button
+    enum RadioButtonProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Checked,
+        Property_Text,
+        Property_TextColor,
+        Property_TextSize,
+        Property_AllowTextClick,
+        Property_Callback,
+        Property_Width,
+        Property_Height
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getRadioButtonProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",     "string", Property_ConfigFile},
+            {"Checked",        "bool",   Property_Checked},
+            {"Text",           "string", Property_Text},
+            {"TextColor",      "color",  Property_TextColor},
+            {"TextSize",       "uint",   Property_TextSize},
+            {"AllowTextClick", "bool",   Property_AllowTextClick},
+            {"Callback",       "",       Property_Callback},
+            {"Width",          "",       Property_Width},
+            {"Height",         "",       Property_Height}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +147,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
          // If the radio button was loaded before then remove the old textures
         if (m_TextureUnchecked.data != nullptr) TGUI_TextureManager.removeTexture(m_TextureUnchecked);
@@ -234,6 +274,8 @@ namespace tgui
         sf::FloatRect textBounds = m_Text.getLocalBounds();
         m_Text.setPosition(x + std::floor(m_Size.x * 11.0f / 10.0f - textBounds.left),
                            y + std::floor(((m_Size.y - textBounds.height) / 2.0f) - textBounds.top));
+
+        markDirty();
     }
 
 
@@ -245,6 +287,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -291,7 +335,8 @@ namespace tgui
         if (m_Checked == false)
         {
             // Tell our parent that all the radio buttons should be unchecked
-            m_Parent->uncheckRadioButtons();
+            if (m_Parent)
+                m_Parent->uncheckRadioButtons();
 
             // Check this radio button
             m_Checked = true;
@@ -304,6 +349,8 @@ namespace tgui
                 addCallback();
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +369,8 @@ namespace tgui
                 addCallback();
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -339,6 +388,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the new text
         m_Text.setString(text);
 
@@ -371,6 +422,7 @@ namespace tgui
     void RadioButton::setTextFont(const sf::Font& font)
     {
         m_Text.setFont(font);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -385,6 +437,7 @@ namespace tgui
     void RadioButton::setTextColor(const sf::Color& Color)
     {
         m_Text.setColor(Color);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -403,6 +456,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text.getString());
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,6 +472,7 @@ namespace tgui
     void RadioButton::allowTextClick(bool acceptTextClick)
     {
         m_AllowTextClick = acceptTextClick;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,65 +597,73 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool RadioButton::setProperty(std::string property, const std::string& value)
+    bool RadioButton::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "checked")
+        switch (getRadioButtonProperties().find(property))
         {
-            if ((value == "true") || (value == "True"))
-                check();
-            else if ((value == "false") || (value == "False"))
-                uncheck();
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Checked' property.");
-        }
-        else if (property == "text")
-        {
-            setText(value);
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "allowtextclick")
-        {
-            if ((value == "true") || (value == "True"))
-                allowTextClick(true);
-            else if ((value == "false") || (value == "False"))
-                allowTextClick(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'AllowTextClick' property.");
-        }
-        else if (property == "callback")
-        {
-            ClickableWidget::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Checked:
+            {
+                if ((value == "true") || (value == "True"))
+                    check();
+                else if ((value == "false") || (value == "False"))
+                    uncheck();
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Checked' property.");
+                break;
+            }
+            case Property_Text:
+            {
+                setText(value);
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_AllowTextClick:
+            {
+                if ((value == "true") || (value == "True"))
+                    allowTextClick(true);
+                else if ((value == "false") || (value == "False"))
+                    allowTextClick(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'AllowTextClick' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                ClickableWidget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "Checked") || (*it == "checked"))
-                    bindCallback(Checked);
-                else if ((*it == "Unchecked") || (*it == "unchecked"))
-                    bindCallback(Unchecked);
-                else if ((*it == "SpaceKeyPressed") || (*it == "spacekeypressed"))
-                    bindCallback(SpaceKeyPressed);
-                else if ((*it == "ReturnKeyPressed") || (*it == "returnkeypressed"))
-                    bindCallback(ReturnKeyPressed);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "Checked") || (*it == "checked"))
+                        bindCallback(Checked);
+                    else if ((*it == "Unchecked") || (*it == "unchecked"))
+                        bindCallback(Unchecked);
+                    else if ((*it == "SpaceKeyPressed") || (*it == "spacekeypressed"))
+                        bindCallback(SpaceKeyPressed);
+                    else if ((*it == "ReturnKeyPressed") || (*it == "returnkeypressed"))
+                        bindCallback(ReturnKeyPressed);
+                }
+                break;
             }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -607,51 +671,61 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool RadioButton::getProperty(std::string property, std::string& value) const
+    bool RadioButton::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "width")
-            value = to_string(m_TextureUnchecked.sprite.getGlobalBounds().width);
-        else if (property == "height")
-            value = to_string(m_TextureUnchecked.sprite.getGlobalBounds().height);
-        else if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "checked")
-            value = m_Checked ? "true" : "false";
-        else if (property == "text")
-            value = getText().toAnsiString();
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "allowtextclick")
-            value = m_AllowTextClick ? "true" : "false";
-        else if (property == "callback")
+        switch (getRadioButtonProperties().find(property))
         {
-            std::string tempValue;
-            ClickableWidget::getProperty(property, tempValue);
-
-            std::vector<sf::String> callbacks;
-
-            if ((m_CallbackFunctions.find(Checked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Checked).size() == 1) && (m_CallbackFunctions.at(Checked).front() == nullptr))
-                callbacks.push_back("Checked");
-            if ((m_CallbackFunctions.find(Unchecked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Unchecked).size() == 1) && (m_CallbackFunctions.at(Unchecked).front() == nullptr))
-                callbacks.push_back("Unchecked");
-            if ((m_CallbackFunctions.find(SpaceKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(SpaceKeyPressed).size() == 1) && (m_CallbackFunctions.at(SpaceKeyPressed).front() == nullptr))
-                callbacks.push_back("SpaceKeyPressed");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
-                callbacks.push_back("ReturnKeyPressed");
-
-            encodeList(callbacks, value);
-
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+            case Property_Width:
+                value = to_string(m_TextureUnchecked.sprite.getGlobalBounds().width);
+                break;
+            case Property_Height:
+                value = to_string(m_TextureUnchecked.sprite.getGlobalBounds().height);
+                break;
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Checked:
+                value = m_Checked ? "true" : "false";
+                break;
+            case Property_Text:
+                value = getText().toAnsiString();
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_AllowTextClick:
+                value = m_AllowTextClick ? "true" : "false";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                ClickableWidget::getProperty(property, tempValue);
+
+                std::vector<sf::String> callbacks;
+
+                if ((m_CallbackFunctions.find(Checked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Checked).size() == 1) && (m_CallbackFunctions.at(Checked).front() == nullptr))
+                    callbacks.push_back("Checked");
+                if ((m_CallbackFunctions.find(Unchecked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Unchecked).size() == 1) && (m_CallbackFunctions.at(Unchecked).front() == nullptr))
+                    callbacks.push_back("Unchecked");
+                if ((m_CallbackFunctions.find(SpaceKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(SpaceKeyPressed).size() == 1) && (m_CallbackFunctions.at(SpaceKeyPressed).front() == nullptr))
+                    callbacks.push_back("SpaceKeyPressed");
+                if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+                    callbacks.push_back("ReturnKeyPressed");
+
+                encodeList(callbacks, value);
+
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
         }
-        else
-            return ClickableWidget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -662,12 +736,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > RadioButton::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Checked", "bool"));
-        list.push_back(std::pair<std::string, std::string>("Text", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
-        list.push_back(std::pair<std::string, std::string>("AllowTextClick", "bool"));
+        getRadioButtonProperties().addToPropertyList(list);
         return list;
     }
 
@@ -27,6 +27,41 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the scrollbar
+    enum ScrollbarProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Maximum,
+        Property_Value,
+        Property_LowValue,
+        Property_VerticalScroll,
+        Property_AutoHide,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getScrollbarProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",     "string", Property_ConfigFile},
+            {"Maximum",        "uint",   Property_Maximum},
+            {"Value",          "uint",   Property_Value},
+            {"LowValue",       "uint",   Property_LowValue},
+            {"VerticalScroll", "bool",   Property_VerticalScroll},
+            {"AutoHide",       "bool",   Property_AutoHide},
+            {"Callback",       "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +192,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // Remove all textures if they were loaded before
         if (m_TextureTrackNormal_L.data != nullptr)   TGUI_TextureManager.removeTexture(m_TextureTrackNormal_L);
@@ -411,6 +447,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the size of the scrollbar
         m_Size.x = width;
         m_Size.y = height;
@@ -473,6 +511,8 @@ namespace tgui
             setValue(0);
         else if (m_Value > m_Maximum - m_LowValue)
             setValue(m_Maximum - m_LowValue);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -498,6 +538,8 @@ namespace tgui
                 addCallback();
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -512,6 +554,8 @@ namespace tgui
             setValue(0);
         else if (m_Value > m_Maximum - m_LowValue)
             setValue(m_Maximum - m_LowValue);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -540,6 +584,8 @@ namespace tgui
                     setSize(m_Size.x, m_Size.y);
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,6 +621,7 @@ namespace tgui
     void Scrollbar::setArrowScrollAmount(unsigned int scrollAmount)
     {
         m_ScrollAmount = scrollAmount;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -589,6 +636,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_AutoHide = autoHide;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -994,59 +1042,67 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Scrollbar::setProperty(std::string property, const std::string& value)
+    bool Scrollbar::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "maximum")
-        {
-            setMaximum(atoi(value.c_str()));
-        }
-        else if (property == "value")
-        {
-            setValue(atoi(value.c_str()));
-        }
-        else if (property == "lowvalue")
-        {
-            setLowValue(atoi(value.c_str()));
-        }
-        else if (property == "verticalscroll")
-        {
-            if ((value == "true") || (value == "True"))
-                setVerticalScroll(true);
-            else if ((value == "false") || (value == "False"))
-                setVerticalScroll(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'VerticalScroll' property.");
-        }
-        else if (property == "callback")
+        switch (getScrollbarProperties().find(property))
         {
-            Widget::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Maximum:
+            {
+                setMaximum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Value:
+            {
+                setValue(atoi(value.c_str()));
+                break;
+            }
+            case Property_LowValue:
+            {
+                setLowValue(atoi(value.c_str()));
+                break;
+            }
+            case Property_VerticalScroll:
+            {
+                if ((value == "true") || (value == "True"))
+                    setVerticalScroll(true);
+                else if ((value == "false") || (value == "False"))
+                    setVerticalScroll(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'VerticalScroll' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                Widget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ValueChanged") || (*it == "valuechanged"))
+                        bindCallback(ValueChanged);
+                }
+                break;
+            }
+            case Property_AutoHide:
             {
-                if ((*it == "ValueChanged") || (*it == "valuechanged"))
-                    bindCallback(ValueChanged);
+                if ((value == "true") || (value == "True"))
+                    setAutoHide(true);
+                else if ((value == "false") || (value == "False"))
+                    setAutoHide(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'AutoHide' property.");
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else if (property == "autohide")
-        {
-            if ((value == "true") || (value == "True"))
-                setAutoHide(true);
-            else if ((value == "false") || (value == "False"))
-                setAutoHide(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'AutoHide' property.");
-        }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1054,41 +1110,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Scrollbar::getProperty(std::string property, std::string& value) const
+    bool Scrollbar::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "maximum")
-            value = to_string(getMaximum());
-        else if (property == "value")
-            value = to_string(getValue());
-        else if (property == "lowvalue")
-            value = to_string(getLowValue());
-        else if (property == "verticalscroll")
-            value = m_VerticalScroll ? "true" : "false";
-        else if (property == "callback")
+        switch (getScrollbarProperties().find(property))
         {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Maximum:
+                value = to_string(getMaximum());
+                break;
+            case Property_Value:
+                value = to_string(getValue());
+                break;
+            case Property_LowValue:
+                value = to_string(getLowValue());
+                break;
+            case Property_VerticalScroll:
+                value = m_VerticalScroll ? "true" : "false";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
-                callbacks.push_back("ValueChanged");
+                if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+                    callbacks.push_back("ValueChanged");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            case Property_AutoHide:
+                value = m_AutoHide ? "true" : "false";
+                break;
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else if (property == "autohide")
-            value = m_AutoHide ? "true" : "false";
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1099,12 +1163,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Scrollbar::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Maximum", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Value", "uint"));
-        list.push_back(std::pair<std::string, std::string>("LowValue", "uint"));
-        list.push_back(std::pair<std::string, std::string>("VerticalScroll", "bool"));
-        list.push_back(std::pair<std::string, std::string>("AutoHide", "bool"));
+        getScrollbarProperties().addToPropertyList(list);
         return list;
     }
 
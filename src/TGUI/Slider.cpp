@@ -28,6 +28,39 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the slider
+    enum SliderProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Minimum,
+        Property_Maximum,
+        Property_Value,
+        Property_VerticalScroll,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getSliderProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",     "string", Property_ConfigFile},
+            {"Minimum",        "uint",   Property_Minimum},
+            {"Maximum",        "uint",   Property_Maximum},
+            {"Value",          "uint",   Property_Value},
+            {"VerticalScroll", "bool",   Property_VerticalScroll},
+            {"Callback",       "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,6 +170,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // Remove all textures if they were loaded before
         if (m_TextureTrackNormal_L.data != nullptr) TGUI_TextureManager.removeTexture(m_TextureTrackNormal_L);
@@ -293,7 +327,7 @@ namespace tgui
                 // Set the thumb size
                 m_ThumbSize = sf::Vector2f(m_TextureThumbNormal.getSize());
 
-                m_TextureTrackNormal_M.data->texture.setRepeated(true);
+                m_TextureTrackNormal_M.setRepeated(true);
             }
             else
             {
@@ -307,7 +341,7 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureTrackHover_M.data->texture.setRepeated(true);
+                m_TextureTrackHover_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -379,8 +413,8 @@ namespace tgui
                     m_TextureTrackNormal_M.sprite.setPosition(x, y + (m_TextureTrackNormal_L.getSize().y * m_TextureTrackNormal_L.sprite.getScale().y));
                     m_TextureTrackHover_M.sprite.setPosition(x, y + (m_TextureTrackHover_L.getSize().y * m_TextureTrackHover_L.sprite.getScale().y));
 
-                    m_TextureTrackNormal_R.sprite.setPosition(x, m_TextureTrackNormal_M.sprite.getPosition().y + (m_TextureTrackNormal_M.sprite.getTextureRect().height * scalingX));
-                    m_TextureTrackHover_R.sprite.setPosition(x, m_TextureTrackHover_M.sprite.getPosition().y + (m_TextureTrackHover_M.sprite.getTextureRect().height * scalingX));
+                    m_TextureTrackNormal_R.sprite.setPosition(x, m_TextureTrackNormal_M.sprite.getPosition().y + (m_TextureTrackNormal_M.getTextureRect().height * scalingX));
+                    m_TextureTrackHover_R.sprite.setPosition(x, m_TextureTrackHover_M.sprite.getPosition().y + (m_TextureTrackHover_M.getTextureRect().height * scalingX));
                 }
                 else // The middle image isn't drawn
                 {
@@ -398,8 +432,8 @@ namespace tgui
                     m_TextureTrackNormal_M.sprite.setPosition(x + (m_TextureTrackNormal_L.getSize().x * m_TextureTrackNormal_L.sprite.getScale().x), y);
                     m_TextureTrackHover_M.sprite.setPosition(x + (m_TextureTrackHover_L.getSize().x * m_TextureTrackHover_L.sprite.getScale().x), y);
 
-                    m_TextureTrackNormal_R.sprite.setPosition(m_TextureTrackNormal_M.sprite.getPosition().x + (m_TextureTrackNormal_M.sprite.getTextureRect().width * scalingY), y);
-                    m_TextureTrackHover_R.sprite.setPosition(m_TextureTrackHover_M.sprite.getPosition().x + (m_TextureTrackHover_M.sprite.getTextureRect().width * scalingY), y);
+                    m_TextureTrackNormal_R.sprite.setPosition(m_TextureTrackNormal_M.sprite.getPosition().x + (m_TextureTrackNormal_M.getTextureRect().width * scalingY), y);
+                    m_TextureTrackHover_R.sprite.setPosition(m_TextureTrackHover_M.sprite.getPosition().x + (m_TextureTrackHover_M.getTextureRect().width * scalingY), y);
                 }
                 else // The middle image isn't drawn
                 {
@@ -413,6 +447,8 @@ namespace tgui
             m_TextureTrackNormal_M.sprite.setPosition(x, y);
             m_TextureTrackHover_M.sprite.setPosition(x, y);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -423,6 +459,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the size of the slider
         m_Size.x = width;
         m_Size.y = height;
@@ -445,8 +483,8 @@ namespace tgui
                     if (m_Size.y < minimumHeight)
                         m_Size.y = minimumHeight;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackHover_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackHover_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
                 }
                 else
                 {
@@ -456,8 +494,8 @@ namespace tgui
                     if (m_Size.x < minimumWidth)
                         m_Size.x = minimumWidth;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
                 }
             }
             else
@@ -470,8 +508,8 @@ namespace tgui
                     if (m_Size.y < minimumHeight)
                         m_Size.y = minimumHeight;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackNormal_M.getSize().y));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackHover_M.getSize().y));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackNormal_M.getSize().y));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackHover_M.getSize().y));
                 }
                 else
                 {
@@ -481,8 +519,8 @@ namespace tgui
                     if (m_Size.x < minimumWidth)
                         m_Size.x = minimumWidth;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackNormal_M.getSize().y));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackHover_M.getSize().y));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackNormal_M.getSize().y));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackHover_M.getSize().y));
                 }
             }
 
@@ -593,6 +631,8 @@ namespace tgui
         // When the value is below the minimum then adjust it
         if (m_Value < m_Minimum)
             setValue(m_Minimum);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -612,6 +652,8 @@ namespace tgui
         // When the value is above the maximum then adjust it
         if (m_Value > m_Maximum)
             setValue(m_Maximum);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -637,6 +679,8 @@ namespace tgui
                 addCallback();
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -665,6 +709,8 @@ namespace tgui
                     setSize(m_Size.x, m_Size.y);
             }
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -859,50 +905,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Slider::setProperty(std::string property, const std::string& value)
+    bool Slider::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
+        switch (getSliderProperties().find(property))
         {
-            load(value);
-        }
-        else if (property == "minimum")
-        {
-            setMinimum(atoi(value.c_str()));
-        }
-        else if (property == "maximum")
-        {
-            setMaximum(atoi(value.c_str()));
-        }
-        else if (property == "value")
-        {
-            setValue(atoi(value.c_str()));
-        }
-        else if (property == "verticalscroll")
-        {
-            if ((value == "true") || (value == "True"))
-                setVerticalScroll(true);
-            else if ((value == "false") || (value == "False"))
-                setVerticalScroll(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'VerticalScroll' property.");
-        }
-        else if (property == "callback")
-        {
-            Widget::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Minimum:
+            {
+                setMinimum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Maximum:
+            {
+                setMaximum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Value:
+            {
+                setValue(atoi(value.c_str()));
+                break;
+            }
+            case Property_VerticalScroll:
+            {
+                if ((value == "true") || (value == "True"))
+                    setVerticalScroll(true);
+                else if ((value == "false") || (value == "False"))
+                    setVerticalScroll(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'VerticalScroll' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                Widget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "ValueChanged") || (*it == "valuechanged"))
-                    bindCallback(ValueChanged);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ValueChanged") || (*it == "valuechanged"))
+                        bindCallback(ValueChanged);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -910,39 +963,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Slider::getProperty(std::string property, std::string& value) const
+    bool Slider::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "minimum")
-            value = to_string(getMinimum());
-        else if (property == "maximum")
-            value = to_string(getMaximum());
-        else if (property == "value")
-            value = to_string(getValue());
-        else if (property == "verticalscroll")
-            value = m_VerticalScroll ? "true" : "false";
-        else if (property == "callback")
+        switch (getSliderProperties().find(property))
         {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Minimum:
+                value = to_string(getMinimum());
+                break;
+            case Property_Maximum:
+                value = to_string(getMaximum());
+                break;
+            case Property_Value:
+                value = to_string(getValue());
+                break;
+            case Property_VerticalScroll:
+                value = m_VerticalScroll ? "true" : "false";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
-                callbacks.push_back("ValueChanged");
+                if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+                    callbacks.push_back("ValueChanged");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -953,11 +1013,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Slider::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Minimum", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Maximum", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Value", "uint"));
-        list.push_back(std::pair<std::string, std::string>("VerticalScroll", "bool"));
+        getSliderProperties().addToPropertyList(list);
         return list;
     }
 
@@ -993,29 +1049,21 @@ namespace tgui
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureTrackHover_L, states);
-                    target.draw(m_TextureTrackHover_M, states);
-                    target.draw(m_TextureTrackHover_R, states);
+                    drawSprites(target, states, {&m_TextureTrackHover_L.sprite, &m_TextureTrackHover_M.sprite, &m_TextureTrackHover_R.sprite});
                 }
                 else
                 {
-                    target.draw(m_TextureTrackNormal_L, states);
-                    target.draw(m_TextureTrackNormal_M, states);
-                    target.draw(m_TextureTrackNormal_R, states);
+                    drawSprites(target, states, {&m_TextureTrackNormal_L.sprite, &m_TextureTrackNormal_M.sprite, &m_TextureTrackNormal_R.sprite});
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureTrackNormal_L, states);
-                target.draw(m_TextureTrackNormal_M, states);
-                target.draw(m_TextureTrackNormal_R, states);
+                drawSprites(target, states, {&m_TextureTrackNormal_L.sprite, &m_TextureTrackNormal_M.sprite, &m_TextureTrackNormal_R.sprite});
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureTrackHover_L, states);
-                    target.draw(m_TextureTrackHover_M, states);
-                    target.draw(m_TextureTrackHover_R, states);
+                    drawSprites(target, states, {&m_TextureTrackHover_L.sprite, &m_TextureTrackHover_M.sprite, &m_TextureTrackHover_R.sprite});
                 }
             }
         }
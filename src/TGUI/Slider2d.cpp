@@ -23,13 +23,47 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Slider2d.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the slider 2d
+    enum Slider2dProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Minimum,
+        Property_Maximum,
+        Property_Value,
+        Property_FixedThumbSize,
+        Property_EnableThumbCenter,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getSlider2dProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",        "string", Property_ConfigFile},
+            {"Minimum",           "custom", Property_Minimum},
+            {"Maximum",           "custom", Property_Maximum},
+            {"Value",             "custom", Property_Value},
+            {"FixedThumbSize",    "bool",   Property_FixedThumbSize},
+            {"EnableThumbCenter", "bool",   Property_EnableThumbCenter},
+            {"Callback",          "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,6 +150,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // Remove all textures if they were loaded before
         if (m_TextureTrackNormal.data != nullptr)  TGUI_TextureManager.removeTexture(m_TextureTrackNormal);
@@ -231,6 +266,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -258,6 +295,8 @@ namespace tgui
             m_Value.x = m_Minimum.x;
         if (m_Value.y < m_Minimum.y)
             m_Value.y = m_Minimum.y;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,6 +317,8 @@ namespace tgui
             m_Value.x = m_Maximum.x;
         if (m_Value.y > m_Maximum.y)
             m_Value.y = m_Maximum.y;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -297,6 +338,8 @@ namespace tgui
             m_Value.y = m_Minimum.y;
         else if (m_Value.y > m_Maximum.y)
             m_Value.y = m_Maximum.y;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,6 +368,7 @@ namespace tgui
     void Slider2d::setFixedThumbSize(bool fixedSize)
     {
         m_FixedThumbSize = fixedSize;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -339,6 +383,7 @@ namespace tgui
     void Slider2d::enableThumbCenter(bool autoCenterThumb)
     {
         m_ReturnThumbToCenter = autoCenterThumb;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -469,112 +514,120 @@ namespace tgui
 
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Slider2d::setProperty(std::string property, const std::string& value)
+    bool Slider2d::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
+        switch (getSlider2dProperties().find(property))
         {
-            load(value);
-        }
-        else if (property == "minimum")
-        {
-            if (value.length() >= 5)
+            case Property_ConfigFile:
             {
-                if ((value[0] == '(') && (value[value.length()-1] == ')'))
+                load(value);
+                break;
+            }
+            case Property_Minimum:
+            {
+                if (value.length() >= 5)
                 {
-                    std::string::size_type commaPos = value.find(',');
-                    if ((commaPos != std::string::npos) && (value.find(',', commaPos + 1) == std::string::npos))
+                    if ((value[0] == '(') && (value[value.length()-1] == ')'))
                     {
-                        setMinimum(sf::Vector2f(static_cast<float>(atof(value.substr(1, commaPos-1).c_str())),
-                                                static_cast<float>(atof(value.substr(commaPos+1, value.length()-commaPos-2).c_str()))));
+                        std::string::size_type commaPos = value.find(',');
+                        if ((commaPos != std::string::npos) && (value.find(',', commaPos + 1) == std::string::npos))
+                        {
+                            setMinimum(sf::Vector2f(static_cast<float>(atof(value.substr(1, commaPos-1).c_str())),
+                                                    static_cast<float>(atof(value.substr(commaPos+1, value.length()-commaPos-2).c_str()))));
+                        }
+                        else
+                            TGUI_OUTPUT("TGUI error: Failed to parse 'Minimum' property.");
                     }
                     else
                         TGUI_OUTPUT("TGUI error: Failed to parse 'Minimum' property.");
                 }
                 else
                     TGUI_OUTPUT("TGUI error: Failed to parse 'Minimum' property.");
+                break;
             }
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Minimum' property.");
-        }
-        else if (property == "maximum")
-        {
-            if (value.length() >= 5)
+            case Property_Maximum:
             {
-                if ((value[0] == '(') && (value[value.length()-1] == ')'))
+                if (value.length() >= 5)
                 {
-                    std::string::size_type commaPos = value.find(',');
-                    if ((commaPos != std::string::npos) && (value.find(',', commaPos + 1) == std::string::npos))
+                    if ((value[0] == '(') && (value[value.length()-1] == ')'))
                     {
-                        setMaximum(sf::Vector2f(static_cast<float>(atof(value.substr(1, commaPos-1).c_str())),
-                                                static_cast<float>(atof(value.substr(commaPos+1, value.length()-commaPos-2).c_str()))));
+                        std::string::size_type commaPos = value.find(',');
+                        if ((commaPos != std::string::npos) && (value.find(',', commaPos + 1) == std::string::npos))
+                        {
+                            setMaximum(sf::Vector2f(static_cast<float>(atof(value.substr(1, commaPos-1).c_str())),
+                                                    static_cast<float>(atof(value.substr(commaPos+1, value.length()-commaPos-2).c_str()))));
+                        }
+                        else
+                            TGUI_OUTPUT("TGUI error: Failed to parse 'Maximum' property.");
                     }
                     else
                         TGUI_OUTPUT("TGUI error: Failed to parse 'Maximum' property.");
                 }
                 else
                     TGUI_OUTPUT("TGUI error: Failed to parse 'Maximum' property.");
+                break;
             }
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Maximum' property.");
-        }
-        else if (property == "value")
-        {
-            if (value.length() >= 5)
+            case Property_Value:
             {
-                if ((value[0] == '(') && (value[value.length()-1] == ')'))
+                if (value.length() >= 5)
                 {
-                    std::string::size_type commaPos = value.find(',');
-                    if ((commaPos != std::string::npos) && (value.find(',', commaPos + 1) == std::string::npos))
+                    if ((value[0] == '(') && (value[value.length()-1] == ')'))
                     {
-                        setValue(sf::Vector2f(static_cast<float>(atof(value.substr(1, commaPos-1).c_str())),
-                                              static_cast<float>(atof(value.substr(commaPos+1, value.length()-commaPos-2).c_str()))));
+                        std::string::size_type commaPos = value.find(',');
+                        if ((commaPos != std::string::npos) && (value.find(',', commaPos + 1) == std::string::npos))
+                        {
+                            setValue(sf::Vector2f(static_cast<float>(atof(value.substr(1, commaPos-1).c_str())),
+                                                  static_cast<float>(atof(value.substr(commaPos+1, value.length()-commaPos-2).c_str()))));
+                        }
+                        else
+                            TGUI_OUTPUT("TGUI error: Failed to parse 'Value' property.");
                     }
                     else
                         TGUI_OUTPUT("TGUI error: Failed to parse 'Value' property.");
                 }
                 else
                     TGUI_OUTPUT("TGUI error: Failed to parse 'Value' property.");
+                break;
             }
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Value' property.");
-        }
-        else if (property == "fixedthumbsize")
-        {
-            if ((value == "true") || (value == "True"))
-                setFixedThumbSize(true);
-            else if ((value == "false") || (value == "False"))
-                setFixedThumbSize(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'FixedThumbSize' property.");
-        }
-        else if (property == "enablethumbcenter")
-        {
-            if ((value == "true") || (value == "True"))
-                enableThumbCenter(true);
-            else if ((value == "false") || (value == "False"))
-                enableThumbCenter(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'EnableThumbCenter' property.");
-        }
-        else if (property == "callback")
-        {
-            ClickableWidget::setProperty(property, value);
+            case Property_FixedThumbSize:
+            {
+                if ((value == "true") || (value == "True"))
+                    setFixedThumbSize(true);
+                else if ((value == "false") || (value == "False"))
+                    setFixedThumbSize(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'FixedThumbSize' property.");
+                break;
+            }
+            case Property_EnableThumbCenter:
+            {
+                if ((value == "true") || (value == "True"))
+                    enableThumbCenter(true);
+                else if ((value == "false") || (value == "False"))
+                    enableThumbCenter(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'EnableThumbCenter' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                ClickableWidget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "ValueChanged") || (*it == "valuechanged"))
-                    bindCallback(ValueChanged);
-                else if ((*it == "ThumbReturnedToCenter") || (*it == "thumbreturnedtocenter"))
-                    bindCallback(ThumbReturnedToCenter);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ValueChanged") || (*it == "valuechanged"))
+                        bindCallback(ValueChanged);
+                    else if ((*it == "ThumbReturnedToCenter") || (*it == "thumbreturnedtocenter"))
+                        bindCallback(ThumbReturnedToCenter);
+                }
+                break;
             }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -582,43 +635,51 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Slider2d::getProperty(std::string property, std::string& value) const
+    bool Slider2d::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "minimum")
-            value = "(" + to_string(getMinimum().x) + "," + to_string(getMinimum().y) + ")";
-        else if (property == "maximum")
-            value = "(" + to_string(getMaximum().x) + "," + to_string(getMaximum().y) + ")";
-        else if (property == "value")
-            value = "(" + to_string(getValue().x) + "," + to_string(getValue().y) + ")";
-        else if (property == "fixedthumbsize")
-            value = m_FixedThumbSize ? "true" : "false";
-        else if (property == "enablethumbcenter")
-            value = m_ReturnThumbToCenter ? "true" : "false";
-        else if (property == "callback")
+        switch (getSlider2dProperties().find(property))
         {
-            std::string tempValue;
-            ClickableWidget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Minimum:
+                value = "(" + to_string(getMinimum().x) + "," + to_string(getMinimum().y) + ")";
+                break;
+            case Property_Maximum:
+                value = "(" + to_string(getMaximum().x) + "," + to_string(getMaximum().y) + ")";
+                break;
+            case Property_Value:
+                value = "(" + to_string(getValue().x) + "," + to_string(getValue().y) + ")";
+                break;
+            case Property_FixedThumbSize:
+                value = m_FixedThumbSize ? "true" : "false";
+                break;
+            case Property_EnableThumbCenter:
+                value = m_ReturnThumbToCenter ? "true" : "false";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                ClickableWidget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
-                callbacks.push_back("ValueChanged");
-            if ((m_CallbackFunctions.find(ThumbReturnedToCenter) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ThumbReturnedToCenter).size() == 1) && (m_CallbackFunctions.at(ThumbReturnedToCenter).front() == nullptr))
-                callbacks.push_back("ThumbReturnedToCenter");
+                if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+                    callbacks.push_back("ValueChanged");
+                if ((m_CallbackFunctions.find(ThumbReturnedToCenter) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ThumbReturnedToCenter).size() == 1) && (m_CallbackFunctions.at(ThumbReturnedToCenter).front() == nullptr))
+                    callbacks.push_back("ThumbReturnedToCenter");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -629,12 +690,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Slider2d::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Minimum", "custom"));
-        list.push_back(std::pair<std::string, std::string>("Maximum", "custom"));
-        list.push_back(std::pair<std::string, std::string>("Value", "custom"));
-        list.push_back(std::pair<std::string, std::string>("FixedThumbSize", "bool"));
-        list.push_back(std::pair<std::string, std::string>("EnableThumbCenter", "bool"));
+        getSlider2dProperties().addToPropertyList(list);
         return list;
     }
 
@@ -646,10 +702,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         // Get the global position
         sf::Vector2f topLeftPosition = states.transform.transformPoint(getPosition() - target.getView().getCenter() + (target.getView().getSize() / 2.f));
         sf::Vector2f bottomRightPosition = states.transform.transformPoint(getPosition() + sf::Vector2f(m_Size) - target.getView().getCenter() + (target.getView().getSize() / 2.f));
@@ -699,24 +751,9 @@ namespace tgui
             states.transform.scale(scaling);
         }
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
 
         // Draw the thumb image
         if (m_SeparateHoverImage)
@@ -735,7 +772,7 @@ namespace tgui
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        clipping.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,39 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the spin button
+    enum SpinButtonProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Minimum,
+        Property_Maximum,
+        Property_Value,
+        Property_VerticalScroll,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getSpinButtonProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",     "string", Property_ConfigFile},
+            {"Minimum",        "uint",   Property_Minimum},
+            {"Maximum",        "uint",   Property_Maximum},
+            {"Value",          "uint",   Property_Value},
+            {"VerticalScroll", "bool",   Property_VerticalScroll},
+            {"Callback",       "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -115,6 +148,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // If the button was loaded before then remove the old textures first
         if (m_TextureArrowUpNormal.data != nullptr)   TGUI_TextureManager.removeTexture(m_TextureArrowUpNormal);
@@ -230,6 +264,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Store the new size
         m_Size.x = width;
         m_Size.y = height;
@@ -253,6 +289,8 @@ namespace tgui
         // When the value is below the minimum then adjust it
         if (m_Value < m_Minimum)
             m_Value = m_Minimum;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,6 +306,8 @@ namespace tgui
         // When the value is above the maximum then adjust it
         if (m_Value > m_Maximum)
             m_Value = m_Maximum;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -282,6 +322,8 @@ namespace tgui
             m_Value = m_Minimum;
         else if (m_Value > m_Maximum)
             m_Value = m_Maximum;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,6 +352,7 @@ namespace tgui
     void SpinButton::setVerticalScroll(bool verticalScroll)
     {
         m_VerticalScroll = verticalScroll;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,6 +452,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(float x, float y)
     {
+        bool mouseHoverOnTopArrow = m_MouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_VerticalScroll)
         {
@@ -425,6 +470,10 @@ namespace tgui
                 m_MouseHoverOnTopArrow = true;
         }
 
+        // Only the arrow below the mouse is drawn with the hover image
+        if (m_MouseHoverOnTopArrow != mouseHoverOnTopArrow)
+            markDirty();
+
         if (m_MouseHover == false)
             mouseEnteredWidget();
 
@@ -441,50 +490,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool SpinButton::setProperty(std::string property, const std::string& value)
+    bool SpinButton::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "minimum")
+        switch (getSpinButtonProperties().find(property))
         {
-            setMinimum(atoi(value.c_str()));
-        }
-        else if (property == "maximum")
-        {
-            setMaximum(atoi(value.c_str()));
-        }
-        else if (property == "value")
-        {
-            setValue(atoi(value.c_str()));
-        }
-        else if (property == "verticalscroll")
-        {
-            if ((value == "true") || (value == "True"))
-                setVerticalScroll(true);
-            else if ((value == "false") || (value == "False"))
-                setVerticalScroll(false);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'VerticalScroll' property.");
-        }
-        else if (property == "callback")
-        {
-            ClickableWidget::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Minimum:
+            {
+                setMinimum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Maximum:
+            {
+                setMaximum(atoi(value.c_str()));
+                break;
+            }
+            case Property_Value:
+            {
+                setValue(atoi(value.c_str()));
+                break;
+            }
+            case Property_VerticalScroll:
+            {
+                if ((value == "true") || (value == "True"))
+                    setVerticalScroll(true);
+                else if ((value == "false") || (value == "False"))
+                    setVerticalScroll(false);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'VerticalScroll' property.");
+                break;
+            }
+            case Property_Callback:
+            {
+                ClickableWidget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "ValueChanged") || (*it == "valuechanged"))
-                    bindCallback(ValueChanged);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "ValueChanged") || (*it == "valuechanged"))
+                        bindCallback(ValueChanged);
+                }
+                break;
             }
+            default: // The property didn't match
+                return ClickableWidget::setProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -492,39 +548,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool SpinButton::getProperty(std::string property, std::string& value) const
+    bool SpinButton::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "minimum")
-            value = to_string(getMinimum());
-        else if (property == "maximum")
-            value = to_string(getMaximum());
-        else if (property == "value")
-            value = to_string(getValue());
-        else if (property == "verticalscroll")
-            value = m_VerticalScroll ? "true" : "false";
-        else if (property == "callback")
+        switch (getSpinButtonProperties().find(property))
         {
-            std::string tempValue;
-            ClickableWidget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Minimum:
+                value = to_string(getMinimum());
+                break;
+            case Property_Maximum:
+                value = to_string(getMaximum());
+                break;
+            case Property_Value:
+                value = to_string(getValue());
+                break;
+            case Property_VerticalScroll:
+                value = m_VerticalScroll ? "true" : "false";
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                ClickableWidget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
-                callbacks.push_back("ValueChanged");
+                if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+                    callbacks.push_back("ValueChanged");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return ClickableWidget::getProperty(property, value);
         }
-        else // The property didn't match
-            return ClickableWidget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -535,11 +598,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > SpinButton::getPropertyList() const
     {
         auto list = ClickableWidget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Minimum", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Maximum", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Value", "uint"));
-        list.push_back(std::pair<std::string, std::string>("VerticalScroll", "bool"));
+        getSpinButtonProperties().addToPropertyList(list);
         return list;
     }
 
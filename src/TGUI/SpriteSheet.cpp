@@ -27,6 +27,31 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the sprite sheet
+    enum SpriteSheetProperty
+    {
+        Property_Rows = 1,
+        Property_Columns
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getSpriteSheetProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"Rows",    "uint", Property_Rows},
+            {"Columns", "uint", Property_Columns}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,12 +107,14 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Store the new size
         m_Size.x = width;
         m_Size.y = height;
 
         // Make sure the sprite has the correct size
-        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.data->texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.data->texture.getSize().y);
+        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.getSize().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +135,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // You can't have 0 rows
         if (rows == 0)
             rows = 1;
@@ -121,13 +150,13 @@ namespace tgui
         m_Columns = columns;
 
         // Make the correct part of the image visible
-        m_Texture.sprite.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.data->texture.getSize().x / m_Columns,
-                                                    (m_VisibleCell.y-1) * m_Texture.data->texture.getSize().y / m_Rows,
-                                                    static_cast<int>(m_Texture.data->texture.getSize().x / m_Columns),
-                                                    static_cast<int>(m_Texture.data->texture.getSize().y / m_Rows)));
+        m_Texture.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.getSize().x / m_Columns,
+                                             (m_VisibleCell.y-1) * m_Texture.getSize().y / m_Rows,
+                                             static_cast<int>(m_Texture.getSize().x / m_Columns),
+                                             static_cast<int>(m_Texture.getSize().y / m_Rows)));
 
         // Make sure the sprite has the correct size
-        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.data->texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.data->texture.getSize().y);
+        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.getSize().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -166,6 +195,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // You can't make a row visible that doesn't exist
         if (row > m_Rows)
             row = m_Rows;
@@ -183,10 +214,10 @@ namespace tgui
         m_VisibleCell.y = row;
 
         // Make the correct part of the image visible
-        m_Texture.sprite.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.data->texture.getSize().x / m_Columns,
-                                                    (m_VisibleCell.y-1) * m_Texture.data->texture.getSize().y / m_Rows,
-                                                    static_cast<int>(m_Texture.data->texture.getSize().x / m_Columns),
-                                                    static_cast<int>(m_Texture.data->texture.getSize().y / m_Rows)));
+        m_Texture.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.getSize().x / m_Columns,
+                                             (m_VisibleCell.y-1) * m_Texture.getSize().y / m_Rows,
+                                             static_cast<int>(m_Texture.getSize().x / m_Columns),
+                                             static_cast<int>(m_Texture.getSize().y / m_Rows)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -198,20 +229,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool SpriteSheet::setProperty(std::string property, const std::string& value)
+    bool SpriteSheet::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "rows")
+        switch (getSpriteSheetProperties().find(property))
         {
-            setRows(atoi(value.c_str()));
+            case Property_Rows:
+            {
+                setRows(atoi(value.c_str()));
+                break;
+            }
+            case Property_Columns:
+            {
+                setColumns(atoi(value.c_str()));
+                break;
+            }
+            default: // The property didn't match
+                return Picture::setProperty(property, value);
         }
-        else if (property == "columns")
-        {
-            setColumns(atoi(value.c_str()));
-        }
-        else // The property didn't match
-            return Picture::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -219,16 +253,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool SpriteSheet::getProperty(std::string property, std::string& value) const
+    bool SpriteSheet::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "rows")
-            value = to_string(getRows());
-        else if (property == "columns")
-            value = to_string(getColumns());
-        else // The property didn't match
-            return Picture::getProperty(property, value);
+        switch (getSpriteSheetProperties().find(property))
+        {
+            case Property_Rows:
+                value = to_string(getRows());
+                break;
+            case Property_Columns:
+                value = to_string(getColumns());
+                break;
+            default: // The property didn't match
+                return Picture::getProperty(property, value);
+        }
 
         // You pass here when one of the properties matched
         return true;
@@ -239,8 +276,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > SpriteSheet::getPropertyList() const
     {
         auto list = Picture::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("Rows", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Columns", "uint"));
+        getSpriteSheetProperties().addToPropertyList(list);
         return list;
     }
 
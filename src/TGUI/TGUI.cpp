@@ -25,6 +25,37 @@
 
 #include <TGUI/TGUI.hpp>
 #include <cctype>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Returns the character that has to be placed behind a backslash to encode the given character,
+    // or 0 when the character can be stored as it is
+    char getEscapeCharacter(char character)
+    {
+        switch (character)
+        {
+            case '\\': return '\\';
+            case '\n': return 'n';
+            case '\t': return 't';
+            case '\"': return '\"';
+            case ',':  return ',';
+            default:   return 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Makes room for extra characters behind the string. The capacity grows at least exponentially, so that
+    // appending many strings after each other stays linear even when every append reserves memory.
+    void reserveForAppend(std::string& output, std::size_t extraSize)
+    {
+        if (output.size() + extraSize > output.capacity())
+            output.reserve(std::max(output.size() + extraSize, 2 * output.capacity()));
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -74,64 +105,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    sf::Color extractColor(std::string string)
+    unsigned int findBracketValues(const char* string, std::size_t length, const char* values[], unsigned int maxValues)
     {
-        int red;
-        int green;
-        int blue;
-        int alpha = 255;
-
-        // Make sure that the line isn't empty
-        if (string.empty() == false)
+        // The first and last character have to be brackets
+        if ((length < 2) || (string[0] != '(') || (string[length-1] != ')'))
+            return 0;
+
+        // The values start behind the opening bracket and behind every comma
+        const char* end = string + length - 1;
+        unsigned int count = 0;
+        values[count++] = string + 1;
+        for (const char* c = string + 1; (c != end) && (count < maxValues); ++c)
         {
-            // The first and last character have to be brackets
-            if ((string[0] == '(') && (string[string.length()-1] == ')'))
-            {
-                // Remove the brackets
-                string.erase(0, 1);
-                string.erase(string.length()-1);
+            if (*c == ',')
+                values[count++] = c + 1;
+        }
 
-                // Search for the first comma
-                std::string::size_type commaPos = string.find(',');
-                if (commaPos != std::string::npos)
-                {
-                    // Get the red value and delete this part of the string
-                    red = atoi(string.substr(0, commaPos).c_str());
-                    string.erase(0, commaPos+1);
-
-                    // Search for the second comma
-                    commaPos = string.find(',');
-                    if (commaPos != std::string::npos)
-                    {
-                        // Get the green value and delete this part of the string
-                        green = atoi(string.substr(0, commaPos).c_str());
-                        string.erase(0, commaPos+1);
-
-                        // Search for the third comma (optional)
-                        commaPos = string.find(',');
-                        if (commaPos != std::string::npos)
-                        {
-                            // Get the blue value and delete this part of the string
-                            blue = atoi(string.substr(0, commaPos).c_str());
-                            string.erase(0, commaPos+1);
-
-                            // Get the alpha value
-                            alpha = atoi(string.c_str());
-                        }
-                        else // No alpha value was passed
-                        {
-                            // Get the blue value
-                            blue = atoi(string.substr(0, commaPos).c_str());
-                        }
-
-                        // All values have to be unsigned chars
-                        return sf::Color(static_cast <unsigned char> (red),
-                                         static_cast <unsigned char> (green),
-                                         static_cast <unsigned char> (blue),
-                                         static_cast <unsigned char> (alpha));
-                    }
-                }
-            }
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Color extractColor(const std::string& string)
+    {
+        // The alpha value is optional
+        const char* values[4];
+        unsigned int count = findBracketValues(string.c_str(), string.length(), values, 4);
+        if (count >= 3)
+        {
+            // All values have to be unsigned chars
+            return sf::Color(static_cast <unsigned char> (atoi(values[0])),
+                             static_cast <unsigned char> (atoi(values[1])),
+                             static_cast <unsigned char> (atoi(values[2])),
+                             static_cast <unsigned char> ((count == 4) ? atoi(values[3]) : 255));
         }
 
         // If you pass here then something is wrong about the line, the color will be black
@@ -158,32 +164,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool extractVector2f(std::string string, sf::Vector2f& vector)
+    bool extractVector2f(const std::string& string, sf::Vector2f& vector)
     {
-        // Make sure that the string isn't empty
-        if (string.empty() == false)
+        const char* values[2];
+        if (findBracketValues(string.c_str(), string.length(), values, 2) == 2)
         {
-            // The first and last character have to be brackets
-            if ((string[0] == '(') && (string[string.length()-1] == ')'))
-            {
-                // Remove the brackets
-                string.erase(0, 1);
-                string.erase(string.length()-1);
-
-                // Search for the first comma
-                std::string::size_type commaPos = string.find(',');
-                if (commaPos != std::string::npos)
-                {
-                    // Get the x value and delete this part of the string
-                    vector.x = static_cast<float>(atof(string.substr(0, commaPos).c_str()));
-                    string.erase(0, commaPos+1);
-
-                    // Get the y value
-                    vector.y = static_cast<float>(atof(string.c_str()));
-
-                    return true;
-                }
-            }
+            vector.x = static_cast<float>(atof(values[0]));
+            vector.y = static_cast<float>(atof(values[1]));
+            return true;
         }
 
         // If you pass here then something is wrong with the string
@@ -192,32 +180,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool extractVector2u(std::string string, sf::Vector2u& vector)
+    bool extractVector2u(const std::string& string, sf::Vector2u& vector)
     {
-        // Make sure that the string isn't empty
-        if (string.empty() == false)
+        const char* values[2];
+        if (findBracketValues(string.c_str(), string.length(), values, 2) == 2)
         {
-            // The first and last character have to be brackets
-            if ((string[0] == '(') && (string[string.length()-1] == ')'))
-            {
-                // Remove the brackets
-                string.erase(0, 1);
-                string.erase(string.length()-1);
-
-                // Search for the first comma
-                std::string::size_type commaPos = string.find(',');
-                if (commaPos != std::string::npos)
-                {
-                    // Get the x value and delete this part of the string
-                    vector.x = static_cast<unsigned int>(atoi(string.substr(0, commaPos).c_str()));
-                    string.erase(0, commaPos+1);
-
-                    // Get the y value
-                    vector.y = static_cast<unsigned int>(atoi(string.c_str()));
-
-                    return true;
-                }
-            }
+            vector.x = static_cast<unsigned int>(atoi(values[0]));
+            vector.y = static_cast<unsigned int>(atoi(values[1]));
+            return true;
         }
 
         // If you pass here then something is wrong with the string
@@ -226,50 +196,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool extractBorders(std::string string, Borders& borders)
+    bool extractBorders(const std::string& string, Borders& borders)
     {
-        // Make sure that the line isn't empty
-        if (string.empty() == false)
+        const char* values[4];
+        if (findBracketValues(string.c_str(), string.length(), values, 4) == 4)
         {
-            // The first and last character have to be brackets
-            if ((string[0] == '(') && (string[string.length()-1] == ')'))
-            {
-                // Remove the brackets
-                string.erase(0, 1);
-                string.erase(string.length()-1);
-
-                // Search for the first comma
-                std::string::size_type commaPos = string.find(',');
-                if (commaPos != std::string::npos)
-                {
-                    // Get the first value and delete this part of the string
-                    borders.left = atoi(string.substr(0, commaPos).c_str());
-                    string.erase(0, commaPos+1);
-
-                    // Search for the second comma
-                    commaPos = string.find(',');
-                    if (commaPos != std::string::npos)
-                    {
-                        // Get the second value and delete this part of the string
-                        borders.top = atoi(string.substr(0, commaPos).c_str());
-                        string.erase(0, commaPos+1);
-
-                        // Search for the third comma
-                        commaPos = string.find(',');
-                        if (commaPos != std::string::npos)
-                        {
-                            // Get the third value and delete this part of the string
-                            borders.right = atoi(string.substr(0, commaPos).c_str());
-                            string.erase(0, commaPos+1);
-
-                            // Get the fourth value
-                            borders.bottom = atoi(string.c_str());
-
-                            return true;
-                        }
-                    }
-                }
-            }
+            borders.left = atoi(values[0]);
+            borders.top = atoi(values[1]);
+            borders.right = atoi(values[2]);
+            borders.bottom = atoi(values[3]);
+            return true;
         }
 
         // If you pass here then something is wrong with the string
@@ -280,54 +216,46 @@ namespace tgui
 
     void encodeString(const std::string& origString, std::string& encodedString)
     {
-        encodedString = origString;
+        encodedString.clear();
+        appendEncodedString(origString, encodedString);
+    }
 
-        // Escape backslashes
-        std::string::size_type pos = encodedString.find('\\');
-        while (pos != std::string::npos)
-        {
-            encodedString.replace(pos, 1, "\\\\");
-            pos = encodedString.find('\\', pos + 2);
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Escape newlines
-        pos = encodedString.find('\n');
-        while (pos != std::string::npos)
+    void appendEncodedString(const std::string& origString, std::string& output)
+    {
+        std::size_t escapeCount = 0;
+        for (auto it = origString.cbegin(); it != origString.cend(); ++it)
         {
-            encodedString.replace(pos, 1, "\\n");
-            pos = encodedString.find('\n', pos + 2);
+            if (getEscapeCharacter(*it))
+                ++escapeCount;
         }
 
-        // Escape tabs
-        pos = encodedString.find('\t');
-        while (pos != std::string::npos)
-        {
-            encodedString.replace(pos, 1, "\\t");
-            pos = encodedString.find('\t', pos + 2);
-        }
+        reserveForAppend(output, origString.size() + escapeCount);
 
-        // Escape quotes
-        pos = encodedString.find('\"');
-        while (pos != std::string::npos)
+        // Copy the characters in between the escaped ones in one go
+        auto copyStart = origString.cbegin();
+        for (auto it = origString.cbegin(); it != origString.cend(); ++it)
         {
-            encodedString.replace(pos, 1, "\\\"");
-            pos = encodedString.find('\"', pos + 2);
+            const char escapeCharacter = getEscapeCharacter(*it);
+            if (escapeCharacter)
+            {
+                output.append(copyStart, it);
+                output += '\\';
+                output += escapeCharacter;
+                copyStart = it + 1;
+            }
         }
 
-        // Escape commas
-        pos = encodedString.find(',');
-        while (pos != std::string::npos)
-        {
-            encodedString.insert(pos, "\\");
-            pos = encodedString.find(',', pos + 2);
-        }
+        output.append(copyStart, origString.cend());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void decodeString(const std::string& encodedString, std::string& decodedString)
     {
-        decodedString = "";
+        decodedString.clear();
+        decodedString.reserve(encodedString.size());
 
         for (auto it = encodedString.cbegin(); it != encodedString.cend(); ++it)
         {
@@ -371,57 +299,30 @@ namespace tgui
 
     void encodeList(const std::vector<sf::String>& list, std::string& encodedString)
     {
-        encodedString = "";
-
-        for (auto it = list.cbegin(); it != list.cend(); ++it)
-        {
-            std::string item = *it;
+        encodedString.clear();
+        appendEncodedList(list, encodedString);
+    }
 
-            // Escape backslashes
-            std::string::size_type pos = item.find('\\');
-            while (pos != std::string::npos)
-            {
-                item.replace(pos, 1, "\\\\");
-                pos = item.find('\\', pos + 2);
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Escape newlines
-            pos = item.find('\n');
-            while (pos != std::string::npos)
-            {
-                item.replace(pos, 1, "\\n");
-                pos = item.find('\n', pos + 2);
-            }
+    void appendEncodedList(const std::vector<sf::String>& list, std::string& output)
+    {
+        if (list.empty())
+            return;
 
-            // Escape tabs
-            pos = item.find('\t');
-            while (pos != std::string::npos)
-            {
-                item.replace(pos, 1, "\\t");
-                pos = item.find('\t', pos + 2);
-            }
+        // Reserve at least the size that is needed when nothing has to be escaped
+        std::size_t size = list.size() - 1;
+        for (auto it = list.cbegin(); it != list.cend(); ++it)
+            size += it->getSize();
 
-            // Escape quotes
-            pos = item.find('\"');
-            while (pos != std::string::npos)
-            {
-                item.replace(pos, 1, "\\\"");
-                pos = item.find('\"', pos + 2);
-            }
+        reserveForAppend(output, size);
 
-            // Escape commas
-            pos = item.find(',');
-            while (pos != std::string::npos)
-            {
-                item.replace(pos, 1, "\\,");
-                pos = item.find(',', pos + 2);
-            }
+        for (auto it = list.cbegin(); it != list.cend(); ++it)
+        {
+            if (it != list.cbegin())
+                output += ',';
 
-            // Add the item to the string
-            if (it == list.cbegin())
-                encodedString += item;
-            else
-                encodedString += "," + item;
+            appendEncodedString(*it, output);
         }
     }
 
@@ -430,6 +331,7 @@ namespace tgui
     void decodeList(const std::string& encodedString, std::vector<sf::String>& list)
     {
         std::string item;
+        item.reserve(encodedString.size());
 
         for (auto it = encodedString.cbegin(); it != encodedString.cend(); ++it)
         {
@@ -470,7 +372,7 @@ namespace tgui
                 if (*it == ',')
                 {
                     list.push_back(item);
-                    item = "";
+                    item.clear();
                 }
                 else // Just a normal character to be added to the string
                     item += *it;
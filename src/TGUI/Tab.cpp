@@ -25,13 +25,51 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Tab.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the tab
+    enum TabProperty
+    {
+        Property_ConfigFile = 1,
+        Property_TextColor,
+        Property_TextSize,
+        Property_TabHeight,
+        Property_MaximumTabWidth,
+        Property_DistanceToSide,
+        Property_Tabs,
+        Property_SelectedTab,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getTabProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",      "string", Property_ConfigFile},
+            {"TextColor",       "color",  Property_TextColor},
+            {"TextSize",        "uint",   Property_TextSize},
+            {"TabHeight",       "uint",   Property_TabHeight},
+            {"MaximumTabWidth", "uint",   Property_MaximumTabWidth},
+            {"DistanceToSide",  "uint",   Property_DistanceToSide},
+            {"Tabs",            "string", Property_Tabs},
+            {"SelectedTab",     "int",    Property_SelectedTab},
+            {"Callback",        "",       Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,6 +175,7 @@ namespace tgui
 
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
+        markDirty();
 
         // If the button was loaded before then remove the old textures first
         if (m_TextureNormal_L.data != nullptr)    TGUI_TextureManager.removeTexture(m_TextureNormal_L);
@@ -278,7 +317,7 @@ namespace tgui
             {
                 m_TabHeight = m_TextureNormal_M.getSize().y;
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -291,7 +330,7 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Selected;
 
-                m_TextureSelected_M.data->texture.setRepeated(true);
+                m_TextureSelected_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -371,6 +410,8 @@ namespace tgui
         if (selectTab)
             m_SelectedTab = m_TabNames.size()-1;
 
+        markDirty();
+
         // Return the index of the new tab
         return m_TabNames.size()-1;
     }
@@ -387,6 +428,7 @@ namespace tgui
             {
                 // Select the tab
                 m_SelectedTab = i;
+                markDirty();
                 return;
             }
         }
@@ -405,6 +447,8 @@ namespace tgui
             return;
         }
 
+        markDirty();
+
         // Select the tab
         m_SelectedTab = index;
     }
@@ -414,6 +458,7 @@ namespace tgui
     void Tab::deselect()
     {
         m_SelectedTab = -1;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -436,6 +481,7 @@ namespace tgui
                 else if (m_SelectedTab > static_cast<int>(i))
                     --m_SelectedTab;
 
+                markDirty();
                 return;
             }
         }
@@ -454,6 +500,8 @@ namespace tgui
             return;
         }
 
+        markDirty();
+
         // Remove the tab
         m_TabNames.erase(m_TabNames.begin() + index);
         m_NameWidth.erase(m_NameWidth.begin() + index);
@@ -472,6 +520,8 @@ namespace tgui
         m_TabNames.clear();
         m_NameWidth.clear();
         m_SelectedTab = -1;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -496,6 +546,7 @@ namespace tgui
     void Tab::setTextFont(const sf::Font& font)
     {
         m_Text.setFont(font);
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -510,6 +561,7 @@ namespace tgui
     void Tab::setTextColor(const sf::Color& color)
     {
         m_TextColor = color;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -524,6 +576,7 @@ namespace tgui
     void Tab::setSelectedTextColor(const sf::Color& color)
     {
         m_SelectedTextColor = color;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -560,6 +613,8 @@ namespace tgui
             m_Text.setString(m_TabNames[i]);
             m_NameWidth[i] = m_Text.getLocalBounds().width;
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -582,6 +637,8 @@ namespace tgui
             if (m_TextSize == 0)
                 setTextSize(0);
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -596,6 +653,7 @@ namespace tgui
     void Tab::setMaximumTabWidth(unsigned int maximumWidth)
     {
         m_MaximumTabWidth = maximumWidth;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -610,6 +668,7 @@ namespace tgui
     void Tab::setDistanceToSide(unsigned int distanceToSide)
     {
         m_DistanceToSide = distanceToSide;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -692,63 +751,73 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Tab::setProperty(std::string property, const std::string& value)
+    bool Tab::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
+        switch (getTabProperties().find(property))
         {
-            load(value);
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "tabheight")
-        {
-            setTabHeight(atoi(value.c_str()));
-        }
-        else if (property == "maximumtabwidth")
-        {
-            setMaximumTabWidth(atoi(value.c_str()));
-        }
-        else if (property == "distancetoside")
-        {
-            setDistanceToSide(atoi(value.c_str()));
-        }
-        else if (property == "tabs")
-        {
-            removeAll();
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_TabHeight:
+            {
+                setTabHeight(atoi(value.c_str()));
+                break;
+            }
+            case Property_MaximumTabWidth:
+            {
+                setMaximumTabWidth(atoi(value.c_str()));
+                break;
+            }
+            case Property_DistanceToSide:
+            {
+                setDistanceToSide(atoi(value.c_str()));
+                break;
+            }
+            case Property_Tabs:
+            {
+                removeAll();
 
-            std::vector<sf::String> tabs;
-            decodeList(value, tabs);
+                std::vector<sf::String> tabs;
+                decodeList(value, tabs);
 
-            for (auto it = tabs.cbegin(); it != tabs.cend(); ++it)
-                add(*it);
-        }
-        else if (property == "selectedtab")
-        {
-            select(atoi(value.c_str()));
-        }
-        else if (property == "callback")
-        {
-            Widget::setProperty(property, value);
+                for (auto it = tabs.cbegin(); it != tabs.cend(); ++it)
+                    add(*it);
+                break;
+            }
+            case Property_SelectedTab:
+            {
+                select(atoi(value.c_str()));
+                break;
+            }
+            case Property_Callback:
+            {
+                Widget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "TabChanged") || (*it == "tabchanged"))
-                    bindCallback(TabChanged);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "TabChanged") || (*it == "tabchanged"))
+                        bindCallback(TabChanged);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -756,45 +825,55 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Tab::getProperty(std::string property, std::string& value) const
+    bool Tab::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "tabheight")
-            value = to_string(getTabHeight());
-        else if (property == "maximumtabwidth")
-            value = to_string(getMaximumTabWidth());
-        else if (property == "distancetoside")
-            value = to_string(getDistanceToSide());
-        else if (property == "tabs")
-            encodeList(m_TabNames, value);
-        else if (property == "selectedtab")
-            value = to_string(getSelectedIndex());
-        else if (property == "callback")
+        switch (getTabProperties().find(property))
         {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_TabHeight:
+                value = to_string(getTabHeight());
+                break;
+            case Property_MaximumTabWidth:
+                value = to_string(getMaximumTabWidth());
+                break;
+            case Property_DistanceToSide:
+                value = to_string(getDistanceToSide());
+                break;
+            case Property_Tabs:
+                encodeList(m_TabNames, value);
+                break;
+            case Property_SelectedTab:
+                value = to_string(getSelectedIndex());
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TabChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TabChanged).size() == 1) && (m_CallbackFunctions.at(TabChanged).front() == nullptr))
-                callbacks.push_back("TabChanged");
+                if ((m_CallbackFunctions.find(TabChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TabChanged).size() == 1) && (m_CallbackFunctions.at(TabChanged).front() == nullptr))
+                    callbacks.push_back("TabChanged");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -805,14 +884,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Tab::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
-        list.push_back(std::pair<std::string, std::string>("TabHeight", "uint"));
-        list.push_back(std::pair<std::string, std::string>("MaximumTabWidth", "uint"));
-        list.push_back(std::pair<std::string, std::string>("DistanceToSide", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Tabs", "string"));
-        list.push_back(std::pair<std::string, std::string>("SelectedTab", "int"));
+        getTabProperties().addToPropertyList(list);
         return list;
     }
 
@@ -832,14 +904,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         // Apply the transformations
         states.transform *= getTransform();
 
@@ -1031,26 +1095,15 @@ namespace tgui
                 states.transform.translate(std::floor(realRect.left + 0.5f), std::floor(realRect.top + 0.5f));
 
                 // Check if clipping is required for this text
+                Clipping clipping;
                 if (clippingRequired)
                 {
                     // Get the global position
                     sf::Vector2f topLeftPosition = states.transform.transformPoint((target.getView().getSize() / 2.f) - target.getView().getCenter());
                     sf::Vector2f bottomRightPosition = states.transform.transformPoint(sf::Vector2f(tabWidth - (2.0f * m_DistanceToSide), (m_TabHeight + defaultRect.height) / 2.f) - target.getView().getCenter() + (target.getView().getSize() / 2.f));
 
-                    // Calculate the clipping area
-                    GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-                    GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                    GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-                    GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                    // If the widget outside the window then don't draw anything
-                    if (scissorRight < scissorLeft)
-                        scissorRight = scissorLeft;
-                    else if (scissorBottom < scissorTop)
-                        scissorTop = scissorBottom;
-
                     // Set the clipping area
-                    glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                    clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
                 }
 
                 // Draw the text
@@ -1063,7 +1116,7 @@ namespace tgui
                 if (clippingRequired)
                 {
                     clippingRequired = false;
-                    glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                    clipping.end();
                 }
             }
 
@@ -23,8 +23,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
+#include <algorithm>
 
+#include <TGUI/ClipStack.hpp>
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/TextBox.hpp>
@@ -32,20 +33,68 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the text box
+    enum TextBoxProperty
+    {
+        Property_ConfigFile = 1,
+        Property_Text,
+        Property_TextSize,
+        Property_MaximumCharacters,
+        Property_Borders,
+        Property_BackgroundColor,
+        Property_TextColor,
+        Property_SelectedTextColor,
+        Property_SelectedTextBackgroundColor,
+        Property_BorderColor,
+        Property_SelectionPointColor,
+        Property_SelectionPointWidth,
+        Property_Callback
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getTextBoxProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"ConfigFile",                  "string",  Property_ConfigFile},
+            {"Text",                        "string",  Property_Text},
+            {"TextSize",                    "uint",    Property_TextSize},
+            {"MaximumCharacters",           "uint",    Property_MaximumCharacters},
+            {"Borders",                     "borders", Property_Borders},
+            {"BackgroundColor",             "color",   Property_BackgroundColor},
+            {"TextColor",                   "color",   Property_TextColor},
+            {"SelectedTextColor",           "color",   Property_SelectedTextColor},
+            {"SelectedTextBackgroundColor", "color",   Property_SelectedTextBackgroundColor},
+            {"BorderColor",                 "color",   Property_BorderColor},
+            {"SelectionPointColor",         "color",   Property_SelectionPointColor},
+            {"SelectionPointWidth",         "uint",    Property_SelectionPointWidth},
+            {"Callback",                    "",        Property_Callback}
+        };
+
+        return properties;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TextBox::TextBox() :
     m_Size                    (360, 200),
-    m_Text                    (""),
     m_DisplayedText           (""),
     m_TextSize                (30),
     m_LineHeight              (40),
     m_Lines                   (1),
+    m_LineStarts              (1, 0),
     m_MaxChars                (0),
     m_TopLine                 (1),
     m_VisibleLines            (1),
+    m_FirstDisplayedLine      (0),
     m_SelChars                (0),
     m_SelStart                (0),
     m_SelEnd                  (0),
@@ -59,7 +108,6 @@ namespace tgui
     m_readOnly                (false)
     {
         m_Callback.widgetType = Type_TextBox;
-        m_AnimatedWidget = true;
         m_DraggableWidget = true;
 
         changeColors();
@@ -80,9 +128,12 @@ namespace tgui
     m_TextSize                   (copy.m_TextSize),
     m_LineHeight                 (copy.m_LineHeight),
     m_Lines                      (copy.m_Lines),
+    m_LineStarts                 (copy.m_LineStarts),
+    m_TextMetrics                (copy.m_TextMetrics),
     m_MaxChars                   (copy.m_MaxChars),
     m_TopLine                    (copy.m_TopLine),
     m_VisibleLines               (copy.m_VisibleLines),
+    m_FirstDisplayedLine         (copy.m_FirstDisplayedLine),
     m_SelChars                   (copy.m_SelChars),
     m_SelStart                   (copy.m_SelStart),
     m_SelEnd                     (copy.m_SelEnd),
@@ -142,9 +193,12 @@ namespace tgui
             std::swap(m_TextSize,                    temp.m_TextSize);
             std::swap(m_LineHeight,                  temp.m_LineHeight);
             std::swap(m_Lines,                       temp.m_Lines);
+            std::swap(m_LineStarts,                  temp.m_LineStarts);
+            std::swap(m_TextMetrics,                 temp.m_TextMetrics);
             std::swap(m_MaxChars,                    temp.m_MaxChars);
             std::swap(m_TopLine,                     temp.m_TopLine);
             std::swap(m_VisibleLines,                temp.m_VisibleLines);
+            std::swap(m_FirstDisplayedLine,          temp.m_FirstDisplayedLine);
             std::swap(m_SelChars,                    temp.m_SelChars);
             std::swap(m_SelStart,                    temp.m_SelStart);
             std::swap(m_SelEnd,                      temp.m_SelEnd);
@@ -188,6 +242,7 @@ namespace tgui
         {
             delete m_Scroll;
             m_Scroll = nullptr;
+            markDirty();
         }
 
         // Open the config file
@@ -276,6 +331,11 @@ namespace tgui
                     m_Scroll->setVerticalScroll(true);
                     m_Scroll->setLowValue(m_Size.y);
                     m_Scroll->setSize(m_Scroll->getSize().x, static_cast<float>(m_Size.y));
+
+                    // The scrollbar takes some of the width of the text
+                    rewrapAllLines();
+                    updateDisplayedText();
+                    markDirty();
                 }
             }
             else
@@ -304,6 +364,8 @@ namespace tgui
         if (m_LineHeight == 0)
             return;
 
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -355,6 +417,7 @@ namespace tgui
         }
 
         // The size of the textbox has changed, update the text
+        rewrapAllLines();
         m_SelectionTextsNeedUpdate = true;
         updateDisplayedText();
     }
@@ -382,8 +445,11 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Store the text
-        m_Text = text;
+        m_Text.setText(text);
+        rewrapAllLines();
 
         // Set the selection point behind the last character
         setSelectionPointPosition(m_Text.getSize());
@@ -397,8 +463,10 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        // Add the text
-        m_Text += text;
+        markDirty();
+
+        // Add the text, only the last line has to be rewrapped
+        insertCharacters(m_Text.getSize(), text);
 
         // Set the selection point behind the last character
         setSelectionPointPosition(m_Text.getSize());
@@ -408,7 +476,7 @@ namespace tgui
 
     sf::String TextBox::getText() const
     {
-        return m_Text;
+        return m_Text.getText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -420,6 +488,16 @@ namespace tgui
         m_TextSelection2.setFont(font);
         m_TextAfterSelection1.setFont(font);
         m_TextAfterSelection2.setFont(font);
+
+        // The characters may have a different width in the new font. The same font object may have been passed again after
+        // it was changed, so the cache is always thrown away.
+        m_TextMetrics.setFont(&font, m_TextSize);
+        m_TextMetrics.invalidate();
+        rewrapAllLines();
+        m_SelectionTextsNeedUpdate = true;
+        updateDisplayedText();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -446,10 +524,13 @@ namespace tgui
         m_TextSelection2.setCharacterSize(m_TextSize);
         m_TextAfterSelection1.setCharacterSize(m_TextSize);
         m_TextAfterSelection2.setCharacterSize(m_TextSize);
+        m_TextMetrics.setFont(m_TextBeforeSelection.getFont(), m_TextSize);
 
         // Calculate the height of one line
         m_LineHeight = m_TextBeforeSelection.getFont()->getLineSpacing(m_TextSize);
 
+        markDirty();
+
         // Don't continue when line height is 0
         if (m_LineHeight == 0)
             return;
@@ -466,6 +547,7 @@ namespace tgui
         }
 
         // The size has changed, update the text
+        rewrapAllLines();
         m_SelectionTextsNeedUpdate = true;
         updateDisplayedText();
     }
@@ -488,11 +570,13 @@ namespace tgui
         if ((m_MaxChars > 0) && (m_Text.getSize() > m_MaxChars))
         {
             // Remove all the excess characters
-            m_Text.erase(m_MaxChars, sf::String::InvalidPos);
+            eraseCharacters(m_MaxChars, m_Text.getSize() - m_MaxChars);
 
             // Set the selection point behind the last character
             setSelectionPointPosition(m_Text.getSize());
         }
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -510,6 +594,8 @@ namespace tgui
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
         m_BottomBorder = bottomBorder;
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -538,6 +624,7 @@ namespace tgui
     void TextBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -547,6 +634,8 @@ namespace tgui
         m_TextBeforeSelection.setColor(textColor);
         m_TextAfterSelection1.setColor(textColor);
         m_TextAfterSelection2.setColor(textColor);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -555,6 +644,8 @@ namespace tgui
     {
         m_TextSelection1.setColor(selectedTextColor);
         m_TextSelection2.setColor(selectedTextColor);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -562,6 +653,7 @@ namespace tgui
     void TextBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
         m_SelectedTextBgrColor = selectedTextBackgroundColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -569,6 +661,7 @@ namespace tgui
     void TextBox::setBorderColor(const sf::Color& borderColor)
     {
         m_BorderColor = borderColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,6 +669,7 @@ namespace tgui
     void TextBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
         m_SelectionPointColor = selectionPointColor;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -632,6 +726,8 @@ namespace tgui
         if (m_LineHeight == 0)
             return;
 
+        markDirty();
+
         // Set the selection point to the correct position
         m_SelChars = 0;
         m_SelStart = charactersBeforeSelectionPoint;
@@ -650,35 +746,8 @@ namespace tgui
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
         {
-            unsigned int newlines = 0;
-            unsigned int newlinesAdded = 0;
-            unsigned int totalLines = 0;
-
-            // Loop through all characters
-            for (unsigned int i=0; i<m_SelEnd; ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        ++totalLines;
-
-                        if (i < m_SelEnd)
-                            ++newlines;
-                    }
-                }
-                else // The text already contains a newline
-                {
-                    ++totalLines;
-
-                    if (i < m_SelEnd)
-                        ++newlines;
-                }
-            }
+            // Find on which line the selection point is located
+            unsigned int newlines = findSelectionPointLine();
 
             // Check if the selection point is located above the view
             if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
@@ -709,6 +778,8 @@ namespace tgui
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
 
+        markDirty();
+
         // If the scrollbar was already created then delete it first
         if (m_Scroll != nullptr)
             delete m_Scroll;
@@ -729,7 +800,11 @@ namespace tgui
             m_Scroll->setVerticalScroll(true);
             m_Scroll->setSize(m_Scroll->getSize().x, static_cast<float>(m_Size.y));
             m_Scroll->setLowValue(m_Size.y);
-            m_Scroll->setMaximum(m_Lines * m_LineHeight);
+
+            // The scrollbar takes some of the width of the text
+            rewrapAllLines();
+            m_SelectionTextsNeedUpdate = true;
+            updateDisplayedText();
 
             return true;
         }
@@ -744,6 +819,13 @@ namespace tgui
         m_Scroll = nullptr;
 
         m_TopLine = 1;
+
+        // The text can use the full width again
+        rewrapAllLines();
+        m_SelectionTextsNeedUpdate = true;
+        updateDisplayedText();
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -751,6 +833,7 @@ namespace tgui
     void TextBox::setSelectionPointWidth(unsigned int width)
     {
         m_SelectionPointWidth = width;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -765,6 +848,7 @@ namespace tgui
     void TextBox::setReadOnly(bool readOnly)
     {
         m_readOnly = readOnly;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -879,35 +963,8 @@ namespace tgui
                 // Check if there is a scrollbar
                 if (m_Scroll != nullptr)
                 {
-                    unsigned int newlines = 0;
-                    unsigned int newlinesAdded = 0;
-                    unsigned int totalLines = 0;
-
-                    // Loop through all characters
-                    for (unsigned int i=0; i<m_SelEnd; ++i)
-                    {
-                        // Make sure there is no newline in the text
-                        if (m_Text[i] != '\n')
-                        {
-                            // Check if there is a newline in the displayed text
-                            if (m_DisplayedText[i + newlinesAdded] == '\n')
-                            {
-                                // A newline was added here
-                                ++newlinesAdded;
-                                ++totalLines;
-
-                                if (i < m_SelEnd)
-                                    ++newlines;
-                            }
-                        }
-                        else // The text already contains a newline
-                        {
-                            ++totalLines;
-
-                            if (i < m_SelEnd)
-                                ++newlines;
-                        }
-                    }
+                    // Find on which line the selection point is located
+                    unsigned int newlines = findSelectionPointLine();
 
                     // Check if the selection point is located above the view
                     if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
@@ -977,8 +1034,6 @@ namespace tgui
                 // If the value of the scrollbar has changed then update the text
                 if (oldValue != m_Scroll->getValue())
                 {
-                    updateDisplayedText();
-
                     // Check if the scrollbar value was incremented (you have pressed on the down arrow)
                     if (m_Scroll->getValue() == oldValue + 1)
                     {
@@ -999,6 +1054,8 @@ namespace tgui
                         else
                             m_Scroll->setValue(m_Scroll->getValue() - m_LineHeight);
                     }
+
+                    updateDisplayedText();
                 }
             }
         }
@@ -1026,6 +1083,9 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            // The scrollbar has no parent, so a change in its hover state has to be reported here
+            bool scrollbarHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + m_Size.x - m_Scroll->getSize().x, getPosition().y);
 
@@ -1053,6 +1113,9 @@ namespace tgui
                     selectText(x, y);
             }
 
+            if (m_Scroll->m_MouseHover != scrollbarHover)
+                markDirty();
+
             // Reset the position
             m_Scroll->setPosition(0, 0);
         }
@@ -1148,194 +1211,30 @@ namespace tgui
         }
         else if (key == sf::Keyboard::Up)
         {
-            sf::Text tempText(m_TextBeforeSelection);
-            tempText.setString(m_DisplayedText);
-
-            bool newlineAdded = false;
-            unsigned int newlinesAdded = 0;
-
-            unsigned int character;
-            unsigned int newTopPosition = 0;
-            sf::Vector2u newPosition(0, 0);
-
-            int distanceX;
-            unsigned int previousdistanceX = m_Size.x;
-
-            // Loop through all characters
-            for (unsigned int i=0; i<m_SelEnd; ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        newlineAdded = true;
-                    }
-                }
-                else // The newline occurs in the text itself
-                    newlineAdded = false;
-            }
-
-            // Get the position of the character behind the selection point
-            sf::Vector2u originalPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAdded));
-
-            // Try to find the line above the selection point
-            for (character=m_SelEnd; character > 0; --character)
-            {
-                // Get the top position of the character before it
-                newTopPosition = static_cast<unsigned int>(tempText.findCharacterPos(character + newlinesAdded - 1).y);
-
-                // Check if the the character is on the line above the original one
-                if (newTopPosition < originalPosition.y)
-                    break;
-            }
-
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
             m_AnimationTimeElapsed = sf::Time();
 
             // Don't do anything when the selection point is on the first line
-            if (character > 0)
+            unsigned int line = findSelectionPointLine();
+            if (line > 0)
             {
-                // Try to find the closest character
-                for ( ; character > 0; --character)
-                {
-                    // Get the position of the character before it
-                    newPosition = sf::Vector2u(tempText.findCharacterPos(character + newlinesAdded - 1));
-
-                    // The character must remain on the same line
-                    if (newPosition.y < newTopPosition)
-                    {
-                        // We have found the character that we were looking for
-                        setSelectionPointPosition(character + newlineAdded);
-                        return;
-                    }
-
-                    // Calculate the distance to the original position
-                    distanceX = newPosition.x - originalPosition.x;
-
-                    // Check if the distance is going away again
-                    if (static_cast<unsigned int>(abs(distanceX)) > previousdistanceX)
-                    {
-                        // We have found the character that we were looking for
-                        setSelectionPointPosition(character + newlineAdded);
-                        return;
-                    }
-
-                    // Remember the previous distance
-                    previousdistanceX = abs(distanceX);
-                }
-
-                // Check if the selection point should be behind the first character
-                if (originalPosition.x > previousdistanceX)
-                {
-                    // We have found the character that we were looking for
-                    setSelectionPointPosition(character + newlineAdded);
-                    return;
-                }
-
-                // If you pass here then the selection point should be at the beginning of the text
-                setSelectionPointPosition(0);
+                // Find the character on the line above that is the closest to the selection point
+                setSelectionPointPosition(findCharacterOnLine(line - 1, static_cast<float>(m_SelectionPointPosition.x)));
             }
         }
         else if (key == sf::Keyboard::Down)
         {
-            sf::Text tempText(m_TextBeforeSelection);
-            tempText.setString(m_DisplayedText);
-
-            bool newlineAdded = false;
-            unsigned int newlinesAdded = 0;
-
-            unsigned int character;
-            unsigned int newTopPosition = 0;
-            sf::Vector2u newPosition(0, 0);
-
-            int distanceX;
-            int previousdistanceX = m_Size.x;
-
-            // Loop through all characters
-            for (unsigned int i=0; i<m_Text.getSize(); ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        newlineAdded = true;
-
-                        // Stop when the newline behind the selection point was found
-                        if (i > m_SelEnd)
-                            break;
-                    }
-                }
-                else // The newline occurs in the text itself
-                {
-                    newlineAdded = false;
-
-                    // Stop when the newline behind the selection point was found
-                    if (i > m_SelEnd)
-                        break;
-                }
-            }
-
-            // Get the position of the character behind the selection point
-            sf::Vector2u originalPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAdded - newlineAdded));
-
-            // Try to find the line below the selection point
-            for (character=m_SelEnd; character < m_Text.getSize(); ++character)
-            {
-                // Get the top position of the character after it
-                newTopPosition = static_cast<unsigned int>(tempText.findCharacterPos(character + newlinesAdded - newlineAdded + 1).y);
-
-                // Check if the the character is on the line below the original one
-                if (newTopPosition > originalPosition.y)
-                    break;
-            }
-
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
             m_AnimationTimeElapsed = sf::Time();
 
             // Don't do anything when the selection point is on the last line
-            if (character < m_Text.getSize())
+            unsigned int line = findSelectionPointLine();
+            if (line + 1 < m_Lines)
             {
-                // Try to find the closest character
-                for ( ; character < m_Text.getSize() + 1; ++character)
-                {
-                    // Get the position of the character after it
-                    newPosition = sf::Vector2u(tempText.findCharacterPos(character + newlinesAdded - newlineAdded + 1));
-
-                    // The character must remain on the same line
-                    if (newPosition.y > newTopPosition)
-                    {
-                        // We have found the character that we were looking for
-                        setSelectionPointPosition(character - newlineAdded);
-                        return;
-                    }
-
-                    // Calculate the distance to the original position
-                    distanceX = newPosition.x - originalPosition.x;
-
-                    // Check if the distance is going away again
-                    if (abs(distanceX) > previousdistanceX)
-                    {
-                        // We have found the character that we were looking for
-                        setSelectionPointPosition(character - newlineAdded);
-                        return;
-                    }
-
-                    // Remember the previous distance
-                    previousdistanceX = abs(distanceX);
-                }
-
-                // If you pass here then the selection point should be at the end of the text
-                setSelectionPointPosition(m_Text.getSize());
+                // Find the character on the line below that is the closest to the selection point
+                setSelectionPointPosition(findCharacterOnLine(line + 1, static_cast<float>(m_SelectionPointPosition.x)));
             }
         }
         else if (key == sf::Keyboard::Home)
@@ -1374,7 +1273,7 @@ namespace tgui
                     return;
 
                 // Erase the character
-                m_Text.erase(m_SelEnd-1, 1);
+                eraseCharacters(m_SelEnd-1, 1);
 
                 // Set the selection point back on the correct position
                 setSelectionPointPosition(m_SelEnd - 1);
@@ -1404,7 +1303,7 @@ namespace tgui
             if (m_CallbackFunctions[TextChanged].empty() == false)
             {
                 m_Callback.trigger = TextChanged;
-                m_Callback.text    = m_Text;
+                m_Callback.text    = m_Text.getText();
                 addCallback();
             }
         }
@@ -1421,7 +1320,7 @@ namespace tgui
                     return;
 
                 // Erase the character
-                m_Text.erase(m_SelEnd, 1);
+                eraseCharacters(m_SelEnd, 1);
 
                 // Set the selection point back on the correct position
                 setSelectionPointPosition(m_SelEnd);
@@ -1451,7 +1350,7 @@ namespace tgui
             if (m_CallbackFunctions[TextChanged].empty() == false)
             {
                 m_Callback.trigger = TextChanged;
-                m_Callback.text    = m_Text;
+                m_Callback.text    = m_Text.getText();
                 addCallback();
             }
         }
@@ -1462,7 +1361,7 @@ namespace tgui
             {
                 if (key == sf::Keyboard::C)
                 {
-                    TGUI_Clipboard.set(m_TextSelection1.getString() + m_TextSelection2.getString());
+                    TGUI_Clipboard.set(m_Text.getText(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars));
                 }
                 else if (key == sf::Keyboard::V)
                 {
@@ -1478,25 +1377,27 @@ namespace tgui
 
                         unsigned int oldCaretPos = m_SelEnd;
 
-                        if (m_Text.getSize() > m_SelEnd)
-                            setText(m_Text.toWideString().substr(0, m_SelEnd) + TGUI_Clipboard.get() + m_Text.toWideString().substr(m_SelEnd, m_Text.getSize() - m_SelEnd));
-                        else
-                            setText(m_Text + clipboardContents);
+                        // Don't exceed the maximum amount of characters
+                        if ((m_MaxChars > 0) && (m_Text.getSize() + clipboardContents.getSize() > m_MaxChars))
+                            clipboardContents.erase(m_MaxChars - std::min(m_MaxChars, m_Text.getSize()), sf::String::InvalidPos);
+
+                        // Only the lines from the selection point onwards have to be rewrapped
+                        insertCharacters(m_SelEnd, clipboardContents);
 
-                        setSelectionPointPosition(oldCaretPos + clipboardContents.getSize());
+                        setSelectionPointPosition(std::min(oldCaretPos + static_cast<unsigned int>(clipboardContents.getSize()), m_Text.getSize()));
 
                         // Add the callback (if the user requested it)
                         if (m_CallbackFunctions[TextChanged].empty() == false)
                         {
                             m_Callback.trigger = TextChanged;
-                            m_Callback.text    = m_Text;
+                            m_Callback.text    = m_Text.getText();
                             addCallback();
                         }
                     }
                 }
                 else if (key == sf::Keyboard::X)
                 {
-                    TGUI_Clipboard.set(m_TextSelection1.getString() + m_TextSelection2.getString());
+                    TGUI_Clipboard.set(m_Text.getText(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars));
 
                     if (m_readOnly)
                         return;
@@ -1525,65 +1426,19 @@ namespace tgui
         if ((m_MaxChars > 0) && (m_Text.getSize() + 1 > m_MaxChars))
                 return;
 
-        // If there is a limit in the amount of lines then make a simulation
-        if (m_Scroll == nullptr)
-        {
-            // Don't continue when line height is 0
-            if (m_LineHeight == 0)
-                return;
-
-            float maxLineWidth = TGUI_MAXIMUM(m_Size.x - 4.0f, 0);
-
-            // Make some preparations
-            sf::Text tempText(m_TextBeforeSelection);
-            unsigned int beginChar = 0;
-            unsigned int newlinesAdded = 0;
-
-            sf::String text = m_Text;
-            text.insert(m_SelEnd, key);
-
-            sf::String displayedText = text;
-            unsigned int lines = 1;
-
-            // Loop through every character
-            for (unsigned i=1; i < text.getSize() + 1; ++i)
-            {
-                // Make sure the character is not a newline
-                if (text[i-1] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(text.toWideString().substr(beginChar, i - beginChar));
-
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i).x > maxLineWidth)
-                    {
-                        // Insert the newline character
-                        displayedText.insert(i + newlinesAdded - 1, '\n');
-
-                        // Prepare to find the next line end
-                        beginChar = i - 1;
-                        ++newlinesAdded;
-                        ++lines;
-                    }
-                }
-                else // The character was a newline
-                {
-                    beginChar = i;
-                    ++lines;
-                }
+        // Insert our character, only the lines from the selection point onwards have to be rewrapped
+        m_Text.insert(m_SelEnd, key);
+        rewrapLines(m_SelEnd, 0, 1);
 
-                // Check if you passed this limit
-                if (lines > m_Size.y / m_LineHeight)
-                {
-                    // The character can't be added
-                    return;
-                }
-            }
+        // If there is a limit in the amount of lines then the character might not fit
+        if ((m_Scroll == nullptr) && (m_LineHeight > 0) && (m_Lines > std::max(1u, m_Size.y / m_LineHeight)))
+        {
+            // The character can't be added
+            m_Text.erase(m_SelEnd, 1);
+            rewrapLines(m_SelEnd, 1, 0);
+            return;
         }
 
-        // Insert our character
-        m_Text.insert(m_SelEnd, key);
-
         // Move our selection point forward
         setSelectionPointPosition(m_SelEnd + 1);
 
@@ -1595,7 +1450,7 @@ namespace tgui
         if (m_CallbackFunctions[TextChanged].empty() == false)
         {
             m_Callback.trigger = TextChanged;
-            m_Callback.text    = m_Text;
+            m_Callback.text    = m_Text.getText();
             addCallback();
         }
     }
@@ -1625,96 +1480,127 @@ namespace tgui
                     else
                         m_Scroll->setValue(0);
                 }
+
+                // Only the visible lines are stored in the displayed text
+                updateDisplayedText();
             }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::widgetFocused()
+    {
+        // The selection point only blinks while the text box is focused, it starts visible
+        m_SelectionPointVisible = true;
+        m_AnimationTimeElapsed = sf::Time();
+        setNeedsUpdates(true);
+
+        Widget::widgetFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::widgetUnfocused()
     {
         // If there is a selection then undo it now
         if (m_SelChars)
             setSelectionPointPosition(m_SelEnd);
 
+        setNeedsUpdates(false);
+
         Widget::widgetUnfocused();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool TextBox::setProperty(std::string property, const std::string& value)
+    bool TextBox::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "configfile")
-        {
-            load(value);
-        }
-        else if (property == "text")
-        {
-            std::string text;
-            decodeString(value, text);
-            setText(text);
-        }
-        else if (property == "textsize")
-        {
-            setTextSize(atoi(value.c_str()));
-        }
-        else if (property == "maximumcharacters")
-        {
-            setMaximumCharacters(atoi(value.c_str()));
-        }
-        else if (property == "borders")
-        {
-            Borders borders;
-            if (extractBorders(value, borders))
-                setBorders(borders.left, borders.top, borders.right, borders.bottom);
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
-        }
-        else if (property == "backgroundcolor")
-        {
-            setBackgroundColor(extractColor(value));
-        }
-        else if (property == "textcolor")
-        {
-            setTextColor(extractColor(value));
-        }
-        else if (property == "selectedtextcolor")
-        {
-            setSelectedTextColor(extractColor(value));
-        }
-        else if (property == "selectedtextbackgroundcolor")
-        {
-            setSelectedTextBackgroundColor(extractColor(value));
-        }
-        else if (property == "bordercolor")
+        switch (getTextBoxProperties().find(property))
         {
-            setBorderColor(extractColor(value));
-        }
-        else if (property == "selectionpointcolor")
-        {
-            setSelectionPointColor(extractColor(value));
-        }
-        else if (property == "selectionpointwidth")
-        {
-            setSelectionPointWidth(atoi(value.c_str()));
-        }
-        else if (property == "callback")
-        {
-            Widget::setProperty(property, value);
+            case Property_ConfigFile:
+            {
+                load(value);
+                break;
+            }
+            case Property_Text:
+            {
+                std::string text;
+                decodeString(value, text);
+                setText(text);
+                break;
+            }
+            case Property_TextSize:
+            {
+                setTextSize(atoi(value.c_str()));
+                break;
+            }
+            case Property_MaximumCharacters:
+            {
+                setMaximumCharacters(atoi(value.c_str()));
+                break;
+            }
+            case Property_Borders:
+            {
+                Borders borders;
+                if (extractBorders(value, borders))
+                    setBorders(borders.left, borders.top, borders.right, borders.bottom);
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Borders' property.");
+                break;
+            }
+            case Property_BackgroundColor:
+            {
+                setBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_TextColor:
+            {
+                setTextColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedTextColor:
+            {
+                setSelectedTextColor(extractColor(value));
+                break;
+            }
+            case Property_SelectedTextBackgroundColor:
+            {
+                setSelectedTextBackgroundColor(extractColor(value));
+                break;
+            }
+            case Property_BorderColor:
+            {
+                setBorderColor(extractColor(value));
+                break;
+            }
+            case Property_SelectionPointColor:
+            {
+                setSelectionPointColor(extractColor(value));
+                break;
+            }
+            case Property_SelectionPointWidth:
+            {
+                setSelectionPointWidth(atoi(value.c_str()));
+                break;
+            }
+            case Property_Callback:
+            {
+                Widget::setProperty(property, value);
 
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
 
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
-            {
-                if ((*it == "TextChanged") || (*it == "textchanged"))
-                    bindCallback(TextChanged);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "TextChanged") || (*it == "textchanged"))
+                        bindCallback(TextChanged);
+                }
+                break;
             }
+            default: // The property didn't match
+                return Widget::setProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::setProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1722,55 +1608,69 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool TextBox::getProperty(std::string property, std::string& value) const
-    {
-        property = toLower(property);
-
-        if (property == "configfile")
-            value = getLoadedConfigFile();
-        else if (property == "text")
-            encodeString(getText(), value);
-        else if (property == "textsize")
-            value = to_string(getTextSize());
-        else if (property == "maximumcharacters")
-            value = to_string(getMaximumCharacters());
-        else if (property == "borders")
-            value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
-        else if (property == "backgroundcolor")
-            value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
-        else if (property == "textcolor")
-            value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
-        else if (property == "selectedtextcolor")
-            value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
-                    + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
-        else if (property == "selectedtextbackgroundcolor")
-            value = "(" + to_string(int(getSelectedTextBackgroundColor().r)) + "," + to_string(int(getSelectedTextBackgroundColor().g))
-                    + "," + to_string(int(getSelectedTextBackgroundColor().b)) + "," + to_string(int(getSelectedTextBackgroundColor().a)) + ")";
-        else if (property == "bordercolor")
-            value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
-        else if (property == "selectionpointcolor")
-            value = "(" + to_string(int(getSelectionPointColor().r)) + "," + to_string(int(getSelectionPointColor().g)) + "," + to_string(int(getSelectionPointColor().b)) + "," + to_string(int(getSelectionPointColor().a)) + ")";
-        else if (property == "selectionpointwidth")
-            value = to_string(getSelectionPointWidth());
-        else if (property == "callback")
+    bool TextBox::getProperty(const std::string& property, std::string& value) const
+    {
+        switch (getTextBoxProperties().find(property))
         {
-            std::string tempValue;
-            Widget::getProperty(property, tempValue);
+            case Property_ConfigFile:
+                value = getLoadedConfigFile();
+                break;
+            case Property_Text:
+                encodeString(getText(), value);
+                break;
+            case Property_TextSize:
+                value = to_string(getTextSize());
+                break;
+            case Property_MaximumCharacters:
+                value = to_string(getMaximumCharacters());
+                break;
+            case Property_Borders:
+                value = "(" + to_string(getBorders().left) + "," + to_string(getBorders().top) + "," + to_string(getBorders().right) + "," + to_string(getBorders().bottom) + ")";
+                break;
+            case Property_BackgroundColor:
+                value = "(" + to_string(int(getBackgroundColor().r)) + "," + to_string(int(getBackgroundColor().g)) + "," + to_string(int(getBackgroundColor().b)) + "," + to_string(int(getBackgroundColor().a)) + ")";
+                break;
+            case Property_TextColor:
+                value = "(" + to_string(int(getTextColor().r)) + "," + to_string(int(getTextColor().g)) + "," + to_string(int(getTextColor().b)) + "," + to_string(int(getTextColor().a)) + ")";
+                break;
+            case Property_SelectedTextColor:
+                value = "(" + to_string(int(getSelectedTextColor().r)) + "," + to_string(int(getSelectedTextColor().g))
+                        + "," + to_string(int(getSelectedTextColor().b)) + "," + to_string(int(getSelectedTextColor().a)) + ")";
+                break;
+            case Property_SelectedTextBackgroundColor:
+                value = "(" + to_string(int(getSelectedTextBackgroundColor().r)) + "," + to_string(int(getSelectedTextBackgroundColor().g))
+                        + "," + to_string(int(getSelectedTextBackgroundColor().b)) + "," + to_string(int(getSelectedTextBackgroundColor().a)) + ")";
+                break;
+            case Property_BorderColor:
+                value = "(" + to_string(int(getBorderColor().r)) + "," + to_string(int(getBorderColor().g)) + "," + to_string(int(getBorderColor().b)) + "," + to_string(int(getBorderColor().a)) + ")";
+                break;
+            case Property_SelectionPointColor:
+                value = "(" + to_string(int(getSelectionPointColor().r)) + "," + to_string(int(getSelectionPointColor().g)) + "," + to_string(int(getSelectionPointColor().b)) + "," + to_string(int(getSelectionPointColor().a)) + ")";
+                break;
+            case Property_SelectionPointWidth:
+                value = to_string(getSelectionPointWidth());
+                break;
+            case Property_Callback:
+            {
+                std::string tempValue;
+                Widget::getProperty(property, tempValue);
 
-            std::vector<sf::String> callbacks;
+                std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TextChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TextChanged).size() == 1) && (m_CallbackFunctions.at(TextChanged).front() == nullptr))
-                callbacks.push_back("TextChanged");
+                if ((m_CallbackFunctions.find(TextChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TextChanged).size() == 1) && (m_CallbackFunctions.at(TextChanged).front() == nullptr))
+                    callbacks.push_back("TextChanged");
 
-            encodeList(callbacks, value);
+                encodeList(callbacks, value);
 
-            if (value.empty())
-                value = tempValue;
-            else if (!tempValue.empty())
-                value += "," + tempValue;
+                if (value.empty())
+                    value = tempValue;
+                else if (!tempValue.empty())
+                    value += "," + tempValue;
+                break;
+            }
+            default: // The property didn't match
+                return Widget::getProperty(property, value);
         }
-        else // The property didn't match
-            return Widget::getProperty(property, value);
 
         // You pass here when one of the properties matched
         return true;
@@ -1781,18 +1681,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > TextBox::getPropertyList() const
     {
         auto list = Widget::getPropertyList();
-        list.push_back(std::pair<std::string, std::string>("ConfigFile", "string"));
-        list.push_back(std::pair<std::string, std::string>("Text", "string"));
-        list.push_back(std::pair<std::string, std::string>("TextSize", "uint"));
-        list.push_back(std::pair<std::string, std::string>("MaximumCharacters", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Borders", "borders"));
-        list.push_back(std::pair<std::string, std::string>("BackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("TextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedTextColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectedTextBackgroundColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("BorderColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectionPointColor", "color"));
-        list.push_back(std::pair<std::string, std::string>("SelectionPointWidth", "uint"));
+        getTextBoxProperties().addToPropertyList(list);
         return list;
     }
 
@@ -1800,170 +1689,27 @@ namespace tgui
 
     unsigned int TextBox::findSelectionPointPosition(float posX, float posY)
     {
-        // This code will crash when the text box is empty. We need to avoid this.
-        if (m_Text.isEmpty())
-            return 0;
-
         // Don't continue when line height is 0
         if (m_LineHeight == 0)
             return 0;
 
-        // Find out on which line you clicked
-        unsigned int line;
+        // Take the scrollbar into account
+        if (m_Scroll != nullptr)
+            posY += m_Scroll->getValue();
 
-        // Check if there is a scrollbar
-        if (m_Scroll == nullptr)
-        {
-            // If the position is negative then set the selection point before the first character
-            if (posY < 0)
-                return 0;
-            else
-                line = static_cast<unsigned int>(posY / m_LineHeight + 1);
-        }
-        else // There is no scrollbar
-        {
-            // If the position is negative then set the selection point before the first character
-            if (posY + m_Scroll->getValue() < 0)
-                return 0;
-            else
-                line = static_cast<unsigned int>((posY + m_Scroll->getValue()) / m_LineHeight + 1);
-        }
+        // If the position is negative then set the selection point before the first character
+        if (posY < 0)
+            return 0;
 
-        // Create a temporary text widget that contains the full text
-        sf::Text fullText(m_TextBeforeSelection);
-        fullText.setString(m_DisplayedText);
+        // Find out on which line you clicked
+        unsigned int line = static_cast<unsigned int>(posY / m_LineHeight);
 
-        // Check if you clicked behind all characters
-        if ((line > m_Lines) || ((line == m_Lines) && (posX > fullText.findCharacterPos(m_DisplayedText.getSize()).x)))
-        {
-            // The selection point should be behind the last character
+        // Check if you clicked below all lines
+        if (line >= m_Lines)
             return m_Text.getSize();
-        }
-        else // You clicked inside the text
-        {
-            // Prepare to skip part of the text
-            sf::String tempString = m_DisplayedText;
-            std::size_t newlinePos = 0;
-
-            // Only remove lines when there are lines to remove
-            if (line > 1)
-            {
-                unsigned int i=1;
 
-                // If the first character is a newline then remove it if needed
-                if (m_Text[0] == '\n')
-                    ++i;
-
-                // Skip the lines above the line where you clicked
-                for ( ; i<line; ++i)
-                    newlinePos = tempString.find('\n', newlinePos + 1);
-
-                // Remove the first lines
-                tempString.erase(0, newlinePos + 1);
-            }
-
-            // Only keep one line
-            std::size_t newlinePos2 = tempString.find('\n');
-            if (newlinePos2 != sf::String::InvalidPos)
-                tempString.erase(newlinePos2, sf::String::InvalidPos);
-
-            // Create a temporary text widget
-            sf::Text tempText(m_TextBeforeSelection);
-
-            // We are going to calculate the number of newlines we have added
-            unsigned int newlinesAdded = 0;
-            unsigned int totalNewlinesAdded = 0;
-            unsigned int beginChar = 0;
-            sf::String   tempString2 = m_Text;
-
-            // Calculate the maximum line width
-            float maxLineWidth = m_Size.x - 4.0f;
-            if (m_Scroll != nullptr)
-                maxLineWidth -= m_Scroll->getSize().x;
-
-            // If the width is negative then the text box is too small to be displayed
-            if (maxLineWidth < 0)
-                maxLineWidth = 0;
-
-            // Loop through every character
-            for (unsigned i = 1; (i < m_Text.getSize() + 1) && (totalNewlinesAdded != line - 1); ++i)
-            {
-                // Make sure the character is not a newline
-                if (m_Text[i-1] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(m_Text.toWideString().substr(beginChar, i - beginChar));
-
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i).x > maxLineWidth)
-                    {
-                        // Insert the newline character
-                        tempString2.insert(i + newlinesAdded - 1, '\n');
-
-                        // Prepare to find the next line end
-                        beginChar = i - 1;
-                        ++newlinesAdded;
-                        ++totalNewlinesAdded;
-                    }
-                }
-                else // The character was a newline
-                {
-                    beginChar = i;
-                    ++totalNewlinesAdded;
-                }
-            }
-
-            // Store the single line that we found a while ago in the temporary text widget
-            tempText.setString(tempString);
-
-            // If the line contains nothing but a newline character then put the selction point on that line
-            if (tempString.getSize() == 0)
-            {
-                if (line > 1)
-                    return newlinePos - newlinesAdded + 1;
-                else
-                    return newlinePos;
-            }
-
-            // Check if the click occured before the first character
-            if ((tempString.getSize() == 1) && (posX < (tempText.findCharacterPos(1).x / 2.f)))
-            {
-                if (line > 1)
-                    return newlinePos - newlinesAdded;
-                else
-                {
-                    if (newlinePos > 0)
-                        return newlinePos - 1;
-                    else
-                        return 0;
-                }
-            }
-
-            // Try to find between which characters the mouse is standing
-            for (unsigned int i = 1; i <= tempString.getSize(); ++i)
-            {
-                if (posX < (tempText.findCharacterPos(i-1).x + tempText.findCharacterPos(i).x) / 2.f)
-                {
-                    if (line > 1)
-                        return newlinePos + i - newlinesAdded;
-                    else
-                        return newlinePos + i - 1;
-                }
-
-            }
-
-            // Check if you clicked behind the last character on the line
-            if (tempText.findCharacterPos(tempString.getSize()).x - (((3.f * tempText.findCharacterPos(tempString.getSize()-1).x) + tempText.findCharacterPos(tempString.getSize()).x) / 2.f))
-            {
-                if (line > 1)
-                    return newlinePos + tempString.getSize() + 1 - newlinesAdded;
-                else
-                    return newlinePos + tempString.getSize();
-            }
-        }
-
-        // Something went wrong, don't move the selection point position
-        return m_SelEnd;
+        // Find the character on the line that is the closest to the mouse
+        return findCharacterOnLine(line, posX);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1974,6 +1720,8 @@ namespace tgui
         if (m_LineHeight == 0)
             return;
 
+        markDirty();
+
         // Find out where the selection point should be
         m_SelEnd = findSelectionPointPosition(posX - getPosition().x - 4, posY - getPosition().y);
 
@@ -1990,35 +1738,8 @@ namespace tgui
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
         {
-            unsigned int newlines = 0;
-            unsigned int newlinesAdded = 0;
-            unsigned int totalLines = 0;
-
-            // Loop through all characters
-            for (unsigned int i=0; i<m_SelEnd; ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        ++totalLines;
-
-                        if (i < m_SelEnd)
-                            ++newlines;
-                    }
-                }
-                else // The text already contains a newline
-                {
-                    ++totalLines;
-
-                    if (i < m_SelEnd)
-                        ++newlines;
-                }
-            }
+            // Find on which line the selection point is located
+            unsigned int newlines = findSelectionPointLine();
 
             // Check if the selection point is located above the view
             if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
@@ -2050,7 +1771,7 @@ namespace tgui
             return;
 
         // Erase the characters
-        m_Text.erase(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars);
+        eraseCharacters(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars);
 
         // Set the selection point back on the correct position
         setSelectionPointPosition(TGUI_MINIMUM(m_SelStart, m_SelEnd));
@@ -2058,16 +1779,168 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateDisplayedText()
+    void TextBox::insertCharacters(unsigned int position, const sf::String& characters)
     {
-        // Don't continue when the text box wasn't loaded correctly
-        if (m_Loaded == false)
+        m_Text.insert(position, characters);
+        rewrapLines(position, 0, characters.getSize());
+
+        // Check if there is a limit in the amount of lines
+        removeExcessLines();
+
+        markDirty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::eraseCharacters(unsigned int position, unsigned int count)
+    {
+        m_Text.erase(position, count);
+        rewrapLines(position, count, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::rewrapLines(unsigned int position, unsigned int removedCharacters, unsigned int insertedCharacters)
+    {
+        float maxLineWidth = getMaximumLineWidth();
+
+        // Find the line on which the text was changed
+        unsigned int line = findLine(position);
+
+        // If the line was wrapped then the characters that were removed might allow a word to move to the line above
+        if ((line > 0) && (m_Text[m_LineStarts[line] - 1] != '\n'))
+            --line;
+
+        // Wrap the lines again until a line starts at the same character as it did before the change
+        std::vector<unsigned int> newLineStarts;
+        unsigned int oldLine = line + 1;
+        unsigned int lineStart = m_LineStarts[line];
+        bool lineBreakFound = true;
+        while (lineBreakFound)
+        {
+            lineStart = wrapLine(lineStart, maxLineWidth, lineBreakFound);
+            if (lineBreakFound == false)
+                break;
+
+            // Once we are past the changed characters, the old lines can be reused when we reach one of them
+            if (lineStart >= position + insertedCharacters)
+            {
+                while ((oldLine < m_Lines) && (m_LineStarts[oldLine] + insertedCharacters < lineStart + removedCharacters))
+                    ++oldLine;
+
+                if ((oldLine < m_Lines)
+                 && (m_LineStarts[oldLine] >= position + removedCharacters)
+                 && (m_LineStarts[oldLine] + insertedCharacters == lineStart + removedCharacters))
+                    break;
+            }
+
+            newLineStarts.push_back(lineStart);
+        }
+
+        // When the end of the text was reached then none of the old lines behind it remain
+        if (lineBreakFound == false)
+            oldLine = m_Lines;
+
+        // The lines that were not rewrapped have to be moved
+        for (unsigned int i = oldLine; i < m_Lines; ++i)
+            m_LineStarts[i] = m_LineStarts[i] + insertedCharacters - removedCharacters;
+
+        // Replace the lines that were rewrapped
+        m_LineStarts.erase(m_LineStarts.begin() + line + 1, m_LineStarts.begin() + oldLine);
+        m_LineStarts.insert(m_LineStarts.begin() + line + 1, newLineStarts.begin(), newLineStarts.end());
+        m_Lines = m_LineStarts.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::rewrapAllLines()
+    {
+        float maxLineWidth = getMaximumLineWidth();
+
+        m_LineStarts.assign(1, 0);
+
+        // Split the text in lines
+        bool lineBreakFound = true;
+        unsigned int lineStart = 0;
+        while (lineBreakFound)
+        {
+            lineStart = wrapLine(lineStart, maxLineWidth, lineBreakFound);
+            if (lineBreakFound)
+                m_LineStarts.push_back(lineStart);
+        }
+
+        m_Lines = m_LineStarts.size();
+
+        // Check if there is a limit in the amount of lines
+        removeExcessLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextBox::wrapLine(unsigned int lineStart, float maxLineWidth, bool& lineBreakFound)
+    {
+        float width = 0;
+        sf::Uint32 previousChar = 0;
+
+        TextDocument::ConstIterator it = m_Text.getIterator(lineStart);
+        for (unsigned int i = lineStart; i < m_Text.getSize(); ++i, ++it)
+        {
+            // The line ends at a newline character
+            if (*it == '\n')
+            {
+                lineBreakFound = true;
+                return i + 1;
+            }
+
+            // Check if the character still fits on the line (there is always at least one character on a line)
+            width += m_TextMetrics.getAdvance(previousChar, *it);
+            if ((width > maxLineWidth) && (i > lineStart))
+            {
+                lineBreakFound = true;
+                return i;
+            }
+
+            previousChar = *it;
+        }
+
+        // The end of the text was reached
+        lineBreakFound = false;
+        return m_Text.getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::removeExcessLines()
+    {
+        // When there is a scrollbar then there is no limit
+        if ((m_Scroll != nullptr) || (m_LineHeight == 0))
             return;
 
-        // Don't continue when line height is 0
-        if (m_LineHeight == 0)
+        markDirty();
+
+        unsigned int maxLines = TGUI_MAXIMUM(m_Size.y / m_LineHeight, 1);
+        if (m_Lines <= maxLines)
             return;
 
+        // Remove all characters starting from the first line that doesn't fit (including the newline in front of it)
+        unsigned int textEnd = m_LineStarts[maxLines];
+        if (m_Text[textEnd - 1] == '\n')
+            --textEnd;
+
+        m_Text.erase(textEnd, m_Text.getSize() - textEnd);
+        m_LineStarts.resize(maxLines);
+        m_Lines = maxLines;
+
+        // Make sure that the selection doesn't contain removed characters
+        m_SelStart = TGUI_MINIMUM(m_SelStart, textEnd);
+        m_SelEnd = TGUI_MINIMUM(m_SelEnd, textEnd);
+        m_SelChars = (m_SelStart < m_SelEnd) ? (m_SelEnd - m_SelStart) : (m_SelStart - m_SelEnd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextBox::getMaximumLineWidth() const
+    {
         float maxLineWidth = m_Size.x - 4.0f;
         if (m_Scroll != nullptr)
             maxLineWidth -= m_Scroll->getSize().x;
@@ -2076,67 +1949,86 @@ namespace tgui
         if (maxLineWidth < 0)
             maxLineWidth = 0;
 
-        // Make some preparations
-        sf::Text tempText(m_TextBeforeSelection);
-        unsigned int beginChar = 0;
-        unsigned int newlinesAdded = 0;
-        unsigned int newlinesAddedBeforeSelection = 0;
+        return maxLineWidth;
+    }
 
-        m_DisplayedText = m_Text;
-        m_Lines = 1;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Loop through every character
-        for (unsigned i=1; i < m_Text.getSize() + 1; ++i)
-        {
-            // Make sure the character is not a newline
-            if (m_Text[i-1] != '\n')
-            {
-                // Add the next character to the text widget
-                tempText.setString(m_Text.toWideString().substr(beginChar, i - beginChar));
+    unsigned int TextBox::findLine(unsigned int character) const
+    {
+        return std::upper_bound(m_LineStarts.begin(), m_LineStarts.end(), character) - m_LineStarts.begin() - 1;
+    }
 
-                // Check if the string still fits on the line
-                if (tempText.findCharacterPos(i).x > maxLineWidth)
-                {
-                    // Insert the newline character
-                    m_DisplayedText.insert(i + newlinesAdded - 1, '\n');
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    // Prepare to find the next line end
-                    beginChar = i - 1;
-                    ++newlinesAdded;
-                    ++m_Lines;
-                }
-            }
-            else // The character was a newline
-            {
-                beginChar = i;
-                ++m_Lines;
-            }
+    unsigned int TextBox::findSelectionPointLine() const
+    {
+        unsigned int line = findLine(m_SelEnd);
 
-            // Find the position of the selection point
-            if (m_SelEnd == i - 1)
-                newlinesAddedBeforeSelection = newlinesAdded;
+        // At the place where a line was wrapped, the selection point is drawn at the end of the first line
+        if ((line > 0) && (m_SelEnd == m_LineStarts[line]) && (m_Text[m_SelEnd - 1] != '\n'))
+            --line;
 
-            // Check if there is a limit in the amount of lines
-            if (m_Scroll == nullptr)
-            {
-                // Check if you passed this limit
-                if (m_Lines > m_Size.y / m_LineHeight)
-                {
-                    // Remove all exceeding lines
-                    m_DisplayedText.erase(i + newlinesAdded - 1, sf::String::InvalidPos);
-                    m_Text.erase(i-1, sf::String::InvalidPos);
+        return line;
+    }
 
-                    // We counted one line too much
-                    --m_Lines;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    break;
-                }
-            }
+    float TextBox::findCharacterPosX(unsigned int line, unsigned int character)
+    {
+        float posX = 0;
+        sf::Uint32 previousChar = 0;
+
+        TextDocument::ConstIterator it = m_Text.getIterator(m_LineStarts[line]);
+        for (unsigned int i = m_LineStarts[line]; i < character; ++i, ++it)
+        {
+            posX += m_TextMetrics.getAdvance(previousChar, *it);
+            previousChar = *it;
+        }
+
+        return posX;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextBox::findCharacterOnLine(unsigned int line, float posX)
+    {
+        unsigned int lineStart = m_LineStarts[line];
+        unsigned int lineEnd = (line + 1 < m_Lines) ? m_LineStarts[line + 1] : m_Text.getSize();
+
+        // The selection point can't be placed behind the newline character
+        if ((lineEnd > lineStart) && (m_Text[lineEnd - 1] == '\n'))
+            --lineEnd;
+
+        // Try to find between which characters the position is located
+        float characterPosX = 0;
+        sf::Uint32 previousChar = 0;
+        TextDocument::ConstIterator it = m_Text.getIterator(lineStart);
+        for (unsigned int i = lineStart; i < lineEnd; ++i, ++it)
+        {
+            float advance = m_TextMetrics.getAdvance(previousChar, *it);
+            if (posX < characterPosX + (advance / 2.f))
+                return i;
+
+            characterPosX += advance;
+            previousChar = *it;
         }
 
-        // Find the position of the selection point
-        if (m_SelEnd == m_Text.getSize())
-            newlinesAddedBeforeSelection = newlinesAdded;
+        // The position is behind the last character on the line
+        return lineEnd;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateDisplayedText()
+    {
+        // Don't continue when the text box wasn't loaded correctly
+        if (m_Loaded == false)
+            return;
+
+        // Don't continue when line height is 0
+        if (m_LineHeight == 0)
+            return;
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -2162,31 +2054,71 @@ namespace tgui
             m_VisibleLines = TGUI_MINIMUM(m_Size.y / m_LineHeight, m_Lines);
         }
 
-        // Fill the temporary text widget with the whole text
-        tempText.setString(m_DisplayedText);
+        // Only the lines that are (partially) visible are placed in the displayed text
+        unsigned int scrollValue = (m_Scroll != nullptr) ? m_Scroll->getValue() : 0;
+        m_FirstDisplayedLine = std::min(scrollValue / m_LineHeight, m_Lines - 1);
+        unsigned int lastDisplayedLine = std::min((scrollValue + m_Size.y + m_LineHeight - 1) / m_LineHeight, m_Lines);
+        if (lastDisplayedLine <= m_FirstDisplayedLine)
+            lastDisplayedLine = m_FirstDisplayedLine + 1;
 
-        // Set the position of the selection point
-        m_SelectionPointPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAddedBeforeSelection));
+        unsigned int displayedTextStart = m_LineStarts[m_FirstDisplayedLine];
+        unsigned int displayedTextEnd = (lastDisplayedLine < m_Lines) ? m_LineStarts[lastDisplayedLine] : m_Text.getSize();
+
+        // Build the displayed text, which has a newline character at every place where a line was wrapped
+        std::basic_string<sf::Uint32> displayedText;
+        displayedText.reserve(displayedTextEnd - displayedTextStart + lastDisplayedLine - m_FirstDisplayedLine);
 
-        // Only do the check when the selection point is not standing at the first character
-        if ((m_SelEnd > 0) && (m_SelEnd + newlinesAddedBeforeSelection > 0))
+        // We also need to know where the selection is located inside the displayed text. A selection that continues
+        // above or below the visible lines is cut off at the beginning or end of the displayed text.
+        unsigned int selectionStart = TGUI_MINIMUM(m_SelStart, m_SelEnd);
+        unsigned int selectionEnd = TGUI_MAXIMUM(m_SelStart, m_SelEnd);
+        unsigned int displayedSelectionStart = 0;
+        unsigned int displayedSelectionEnd = 0;
+
+        unsigned int newlinesAdded = 0;
+        for (unsigned int line = m_FirstDisplayedLine; line < lastDisplayedLine; ++line)
         {
-            // If you are at the end of the line then also set the selection point there, instead of at the beginning of the next line
-            if ((m_Text[m_SelEnd - 1] != '\n') && (m_DisplayedText[m_SelEnd + newlinesAddedBeforeSelection - 1] == '\n'))
-                m_SelectionPointPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAddedBeforeSelection - 1));
+            unsigned int lineStart = m_LineStarts[line];
+            unsigned int lineEnd = (line + 1 < m_Lines) ? m_LineStarts[line + 1] : m_Text.getSize();
+
+            if ((line > m_FirstDisplayedLine) && (m_Text[lineStart - 1] != '\n'))
+            {
+                displayedText.push_back('\n');
+                ++newlinesAdded;
+            }
+
+            m_Text.appendText(displayedText, lineStart, lineEnd - lineStart);
+
+            // A selection that starts where a line was wrapped is placed in front of the added newline
+            if ((selectionStart > lineStart) && (selectionStart <= lineEnd))
+                displayedSelectionStart = selectionStart - displayedTextStart + newlinesAdded;
+            if ((selectionEnd > lineStart) && (selectionEnd <= lineEnd))
+                displayedSelectionEnd = selectionEnd - displayedTextStart + newlinesAdded;
         }
 
+        // A selection that continues below the visible lines ends at the end of the displayed text
+        if (selectionStart > displayedTextEnd)
+            displayedSelectionStart = displayedText.size();
+        if (selectionEnd > displayedTextEnd)
+            displayedSelectionEnd = displayedText.size();
+
+        m_DisplayedText = displayedText;
+
+        // Set the position of the selection point
+        unsigned int selectionPointLine = findSelectionPointLine();
+        m_SelectionPointPosition = sf::Vector2u(static_cast<unsigned int>(findCharacterPosX(selectionPointLine, m_SelEnd)), selectionPointLine * m_LineHeight);
+
         // Check if the text has to be redivided in five pieces
         if (m_SelectionTextsNeedUpdate)
-            updateSelectionTexts(maxLineWidth);
+            updateSelectionTexts(displayedSelectionStart, displayedSelectionEnd);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts(float maxLineWidth)
+    void TextBox::updateSelectionTexts(unsigned int selectionStart, unsigned int selectionEnd)
     {
-        // If there is no selection then just put the whole text in m_TextBeforeSelection
-        if (m_SelChars == 0)
+        // If there is no (visible) selection then just put the whole text in m_TextBeforeSelection
+        if (selectionStart == selectionEnd)
         {
             m_TextBeforeSelection.setString(m_DisplayedText);
             m_TextSelection1.setString("");
@@ -2199,139 +2131,78 @@ namespace tgui
         }
         else // Some text is selected
         {
-            // Make some preparations
-            unsigned i;
-            unsigned int selectionStart = TGUI_MINIMUM(m_SelEnd, m_SelStart);
-            unsigned int selectionEnd = TGUI_MAXIMUM(m_SelEnd, m_SelStart);
-
-            sf::Text tempText(m_TextBeforeSelection);
-            unsigned int beginChar = 0;
-            unsigned int newlinesAddedBeforeSelection = 0;
-            unsigned int newlinesAddedInsideSelection = 0;
-            unsigned int lastNewlineBeforeSelection = 0;
-            bool newlineFoundInsideSelection = false;
+            unsigned int i;
+            std::basic_string<sf::Uint32> displayedText(m_DisplayedText.begin(), m_DisplayedText.end());
 
             // Clear the list of selection rectangle sizes
             m_MultilineSelectionRectWidth.clear();
 
-            // Loop through every character before the selection
-            for (i=0; i < selectionStart; ++i)
-            {
-                // Make sure the character is not a newline
-                if (m_Text[i] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(m_Text.toWideString().substr(beginChar, i - beginChar + 1));
-
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i+1).x > maxLineWidth)
-                    {
-                        beginChar = i;
-                        lastNewlineBeforeSelection = i;
-                        ++newlinesAddedBeforeSelection;
-                    }
-                }
-                else // The character was a newline
-                {
-                    beginChar = i+1;
-                    lastNewlineBeforeSelection = i;
-                }
-            }
-
-            // Reset the position from where we should start looking for newlines
-            beginChar = lastNewlineBeforeSelection;
-
-            // Loop through every selected character
-            for (i=selectionStart; i < selectionEnd; ++i)
-            {
-                // Make sure the character is not a newline
-                if (m_Text[i] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(m_Text.toWideString().substr(beginChar, i - beginChar + 1));
-
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i+1).x > maxLineWidth)
-                    {
-                        beginChar = i;
-                        ++newlinesAddedInsideSelection;
-                    }
-                }
-                else // The character was a newline
-                    beginChar = i+1;
-            }
-
-            // Find out where the selection starts and where it ends
-            if (m_SelEnd < m_SelStart)
-            {
-                selectionStart = m_SelEnd + newlinesAddedBeforeSelection;
-                selectionEnd = m_SelStart + newlinesAddedBeforeSelection + newlinesAddedInsideSelection;
-            }
-            else
-            {
-                selectionStart = m_SelStart + newlinesAddedBeforeSelection;
-                selectionEnd = m_SelEnd + newlinesAddedBeforeSelection + newlinesAddedInsideSelection;
-            }
-
-            // Create another temprary text widget
-            sf::Text tempText2(m_TextBeforeSelection);
-            tempText2.setString(m_DisplayedText);
-
-            // Loop through the selected characters again
+            // Find the widths of the selected lines, except for the first one
+            bool newlineFoundInsideSelection = false;
+            float lineWidth = 0;
+            sf::Uint32 previousChar = 0;
             for (i=selectionStart; i<selectionEnd; ++i)
             {
-                if (m_DisplayedText[i] == '\n')
+                if (displayedText[i] == '\n')
                 {
                     // Check if this is not the first newline
                     if (newlineFoundInsideSelection == true)
                     {
                         // Add a new rectangle to the selection
-                        if (tempText2.findCharacterPos(i).x > 0)
-                            m_MultilineSelectionRectWidth.push_back(tempText2.findCharacterPos(i).x);
+                        if (lineWidth > 0)
+                            m_MultilineSelectionRectWidth.push_back(lineWidth);
                         else
                             m_MultilineSelectionRectWidth.push_back(2);
                     }
                     else // This is the first newline, skip it
                         newlineFoundInsideSelection = true;
+
+                    lineWidth = 0;
+                    previousChar = 0;
+                }
+                else
+                {
+                    lineWidth += m_TextMetrics.getAdvance(previousChar, displayedText[i]);
+                    previousChar = displayedText[i];
                 }
             }
 
             // Add the last selection rectangle
-            m_MultilineSelectionRectWidth.push_back(tempText2.findCharacterPos(i).x);
+            m_MultilineSelectionRectWidth.push_back(lineWidth);
 
             // Set the text before selection
-            m_TextBeforeSelection.setString(m_DisplayedText.toWideString().substr(0, selectionStart));
+            m_TextBeforeSelection.setString(displayedText.substr(0, selectionStart));
 
             // Set the text that is selected. If it consists of multiple lines then it will be changed below.
-            m_TextSelection1.setString(m_DisplayedText.toWideString().substr(selectionStart, m_SelChars));
+            m_TextSelection1.setString(displayedText.substr(selectionStart, selectionEnd - selectionStart));
             m_TextSelection2.setString("");
 
             // Loop through every character inside the selection
             for (i=selectionStart; i < selectionEnd; ++i)
             {
                 // Check if the character is a newline
-                if (m_DisplayedText[i] == '\n')
+                if (displayedText[i] == '\n')
                 {
                     // Set the text that is selected
-                    m_TextSelection1.setString(m_DisplayedText.toWideString().substr(selectionStart, i - selectionStart));
-                    m_TextSelection2.setString(m_DisplayedText.toWideString().substr(i + 1, m_SelChars + newlinesAddedInsideSelection + selectionStart - i - 1));
+                    m_TextSelection1.setString(displayedText.substr(selectionStart, i - selectionStart));
+                    m_TextSelection2.setString(displayedText.substr(i + 1, selectionEnd - i - 1));
                     break;
                 }
             }
 
             // Set the text after the selection. If it consists of multiple lines then it will be changed below.
-            m_TextAfterSelection1.setString(m_DisplayedText.toWideString().substr(selectionEnd, m_DisplayedText.getSize() - selectionEnd));
+            m_TextAfterSelection1.setString(displayedText.substr(selectionEnd));
             m_TextAfterSelection2.setString("");
 
             // Loop through every character after the selection
-            for (i=selectionEnd; i < m_DisplayedText.getSize(); ++i)
+            for (i=selectionEnd; i < displayedText.size(); ++i)
             {
                 // Check if the character is a newline
-                if (m_DisplayedText[i] == '\n')
+                if (displayedText[i] == '\n')
                 {
                     // Set the text that is selected
-                    m_TextAfterSelection1.setString(m_DisplayedText.toWideString().substr(selectionEnd, i - selectionEnd));
-                    m_TextAfterSelection2.setString(m_DisplayedText.toWideString().substr(i + 1, m_DisplayedText.getSize() - i - 1));
+                    m_TextAfterSelection1.setString(displayedText.substr(selectionEnd, i - selectionEnd));
+                    m_TextAfterSelection2.setString(displayedText.substr(i + 1));
                     break;
                 }
             }
@@ -2364,22 +2235,32 @@ namespace tgui
         // Switch the value of the visible flag
         m_SelectionPointVisible = !m_SelectionPointVisible;
 
+        // The selection point is only drawn while the text box is focused
+        if (m_Focused)
+            markDirty();
+
         // Too slow for double clicking
         m_PossibleDoubleClick = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time TextBox::getTimeUntilUpdate() const
+    {
+        if (m_AnimationTimeElapsed < sf::milliseconds(500))
+            return sf::milliseconds(500) - m_AnimationTimeElapsed;
+        else
+            return sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Don't draw anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / target.getView().getSize().x;
-        float scaleViewY = target.getSize().y / target.getView().getSize().y;
-
         // Get the global position
         sf::Vector2f topLeftPosition = states.transform.transformPoint(getPosition() - target.getView().getCenter() + (target.getView().getSize() / 2.f));
         sf::Vector2f bottomRightPosition = states.transform.transformPoint(getPosition() + sf::Vector2f(m_Size) - target.getView().getCenter() + (target.getView().getSize() / 2.f));
@@ -2391,28 +2272,7 @@ namespace tgui
         sf::Transform origTransform = states.transform;
 
         // Draw the borders
-        {
-            // Draw left border
-            sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y + m_TopBorder)));
-            border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
-            border.setFillColor(m_BorderColor);
-            target.draw(border, states);
-
-            // Draw top border
-            border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_RightBorder), static_cast<float>(m_TopBorder)));
-            border.setPosition(0, -static_cast<float>(m_TopBorder));
-            target.draw(border, states);
-
-            // Draw right border
-            border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y + m_BottomBorder)));
-            border.setPosition(static_cast<float>(m_Size.x), 0);
-            target.draw(border, states);
-
-            // Draw bottom border
-            border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_LeftBorder), static_cast<float>(m_BottomBorder)));
-            border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y));
-            target.draw(border, states);
-        }
+        drawBorders(target, states, sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)), m_BorderColor);
 
         // Draw the background
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)));
@@ -2428,30 +2288,18 @@ namespace tgui
         // Remeber this tranformation
         sf::Transform oldTransform = states.transform;
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        // The displayed text starts at the first visible line
+        states.transform.translate(0, static_cast<float>(m_FirstDisplayedLine * m_LineHeight));
 
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        Clipping clipping;
+        clipping.begin(getClipStack(), target, topLeftPosition, bottomRightPosition);
 
         // Draw the text
         target.draw(m_TextBeforeSelection, states);
 
-        // Check if there is a selection
-        if (m_SelChars > 0)
+        // Check if there is a visible selection
+        if ((m_TextSelection1.getString().getSize() > 0) || (m_TextSelection2.getString().getSize() > 0))
         {
             // Store the lenghts of the texts
             unsigned int textBeforeSelectionLength = m_TextBeforeSelection.getString().getSize() + 1;
@@ -2572,7 +2420,7 @@ namespace tgui
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        clipping.end();
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
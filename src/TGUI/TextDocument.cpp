@@ -0,0 +1,351 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <TGUI/TextDocument.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // A chunk that grows larger than the maximum size is split in chunks of half that size
+    const unsigned int MaximumChunkSize = 4096;
+
+    // A chunk that becomes smaller than this is merged with the chunk behind it when they fit together
+    const unsigned int MinimumChunkSize = MaximumChunkSize / 4;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextDocument::ConstIterator::ConstIterator(const TextDocument* document, unsigned int chunk, unsigned int offset) :
+    m_Document(document),
+    m_Chunk   (chunk),
+    m_Offset  (offset)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint32 TextDocument::ConstIterator::operator*() const
+    {
+        return m_Document->m_Chunks[m_Chunk][m_Offset];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextDocument::ConstIterator& TextDocument::ConstIterator::operator++()
+    {
+        // Jump to the next chunk when we are at the end of the current one
+        if ((++m_Offset == m_Document->m_Chunks[m_Chunk].size()) && (m_Chunk + 1 < m_Document->m_Chunks.size()))
+        {
+            ++m_Chunk;
+            m_Offset = 0;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextDocument::TextDocument() :
+    m_ChunkTree(1, 0),
+    m_Size     (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextDocument::setText(const sf::String& text)
+    {
+        m_Chunks.clear();
+        m_ChunkTree.assign(1, 0);
+        m_Size = 0;
+
+        insert(0, text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextDocument::getText() const
+    {
+        return getText(0, m_Size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextDocument::getText(unsigned int position, unsigned int count) const
+    {
+        std::basic_string<sf::Uint32> text;
+        appendText(text, position, count);
+        return text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextDocument::appendText(std::basic_string<sf::Uint32>& string, unsigned int position, unsigned int count) const
+    {
+        if (position >= m_Size)
+            return;
+
+        count = std::min(count, m_Size - position);
+        string.reserve(string.size() + count);
+
+        unsigned int offset;
+        unsigned int chunk = findChunk(position, offset);
+        while (count > 0)
+        {
+            unsigned int length = std::min(count, static_cast<unsigned int>(m_Chunks[chunk].size()) - offset);
+            string.append(m_Chunks[chunk], offset, length);
+
+            count -= length;
+            offset = 0;
+            ++chunk;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextDocument::getSize() const
+    {
+        return m_Size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextDocument::isEmpty() const
+    {
+        return m_Size == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint32 TextDocument::operator[](unsigned int position) const
+    {
+        unsigned int offset;
+        unsigned int chunk = findChunk(position, offset);
+        return m_Chunks[chunk][offset];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextDocument::ConstIterator TextDocument::getIterator(unsigned int position) const
+    {
+        if (m_Chunks.empty())
+            return ConstIterator(this, 0, 0);
+
+        unsigned int offset;
+        unsigned int chunk = findChunk(position, offset);
+        return ConstIterator(this, chunk, offset);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextDocument::insert(unsigned int position, const sf::String& text)
+    {
+        if (text.isEmpty())
+            return;
+
+        position = std::min(position, m_Size);
+
+        // An empty document doesn't have any chunks yet
+        if (m_Chunks.empty())
+        {
+            m_Chunks.push_back(std::basic_string<sf::Uint32>(text.begin(), text.end()));
+            m_Size = text.getSize();
+
+            if (m_Chunks[0].size() > MaximumChunkSize)
+                splitChunk(0);
+            else
+                rebuildChunkTree();
+            return;
+        }
+
+        unsigned int offset;
+        unsigned int chunk = findChunk(position, offset);
+
+        m_Chunks[chunk].insert(m_Chunks[chunk].begin() + offset, text.begin(), text.end());
+        m_Size += text.getSize();
+
+        if (m_Chunks[chunk].size() > MaximumChunkSize)
+            splitChunk(chunk);
+        else
+            updateChunkSize(chunk, text.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextDocument::insert(unsigned int position, sf::Uint32 character)
+    {
+        insert(position, sf::String(character));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextDocument::erase(unsigned int position, unsigned int count)
+    {
+        if (position >= m_Size)
+            return;
+
+        count = std::min(count, m_Size - position);
+        if (count == 0)
+            return;
+
+        m_Size -= count;
+
+        unsigned int offset;
+        unsigned int chunk = findChunk(position, offset);
+
+        // Remove the characters from the first chunk
+        unsigned int erased = std::min(count, static_cast<unsigned int>(m_Chunks[chunk].size()) - offset);
+        m_Chunks[chunk].erase(offset, erased);
+        updateChunkSize(chunk, -static_cast<int>(erased));
+        count -= erased;
+
+        // Find out which chunks are removed completely
+        unsigned int lastChunk = chunk + 1;
+        while ((count > 0) && (count >= m_Chunks[lastChunk].size()))
+        {
+            count -= m_Chunks[lastChunk].size();
+            ++lastChunk;
+        }
+
+        // Remove the remaining characters from the beginning of the last chunk
+        if (count > 0)
+        {
+            m_Chunks[lastChunk].erase(0, count);
+            updateChunkSize(lastChunk, -static_cast<int>(count));
+        }
+
+        // The tree only has to be rebuilt when chunks are removed or merged, most of the time the characters are all located
+        // inside a single chunk that remains big enough
+        bool chunksChanged = (lastChunk > chunk + 1);
+        m_Chunks.erase(m_Chunks.begin() + chunk + 1, m_Chunks.begin() + lastChunk);
+
+        // Don't keep an empty chunk
+        if (m_Chunks[chunk].empty())
+        {
+            m_Chunks.erase(m_Chunks.begin() + chunk);
+            chunksChanged = true;
+        }
+
+        // Merge a small chunk with the one behind it
+        else if ((m_Chunks[chunk].size() < MinimumChunkSize) && (chunk + 1 < m_Chunks.size())
+              && (m_Chunks[chunk].size() + m_Chunks[chunk + 1].size() <= MaximumChunkSize))
+        {
+            m_Chunks[chunk] += m_Chunks[chunk + 1];
+            m_Chunks.erase(m_Chunks.begin() + chunk + 1);
+            chunksChanged = true;
+        }
+
+        if (chunksChanged)
+            rebuildChunkTree();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextDocument::findChunk(unsigned int position, unsigned int& offset) const
+    {
+        // Search for the amount of chunks that end before or at the position
+        unsigned int chunk = 0;
+        unsigned int step = 1;
+        while (step * 2 < m_ChunkTree.size())
+            step *= 2;
+
+        for ( ; step > 0; step /= 2)
+        {
+            if ((chunk + step < m_ChunkTree.size()) && (m_ChunkTree[chunk + step] <= position))
+            {
+                chunk += step;
+                position -= m_ChunkTree[chunk];
+            }
+        }
+
+        // When the position lies behind the last character then return the end of the last chunk
+        if (chunk == m_Chunks.size())
+        {
+            --chunk;
+            position += m_Chunks[chunk].size();
+        }
+
+        offset = position;
+        return chunk;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextDocument::splitChunk(unsigned int chunk)
+    {
+        std::basic_string<sf::Uint32> characters;
+        characters.swap(m_Chunks[chunk]);
+
+        // Divide the characters evenly over chunks that are about half the maximum size
+        unsigned int pieces = (characters.size() + (MaximumChunkSize / 2) - 1) / (MaximumChunkSize / 2);
+        std::vector< std::basic_string<sf::Uint32> > newChunks(pieces);
+        for (unsigned int i = 0; i < pieces; ++i)
+        {
+            unsigned int begin = static_cast<unsigned int>(characters.size() * i / pieces);
+            unsigned int end = static_cast<unsigned int>(characters.size() * (i + 1) / pieces);
+            newChunks[i].assign(characters, begin, end - begin);
+        }
+
+        // New chunks were inserted, so the sizes in the tree all have to be calculated again
+        m_Chunks.erase(m_Chunks.begin() + chunk);
+        m_Chunks.insert(m_Chunks.begin() + chunk, newChunks.begin(), newChunks.end());
+        rebuildChunkTree();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextDocument::updateChunkSize(unsigned int chunk, int difference)
+    {
+        for (unsigned int i = chunk + 1; i < m_ChunkTree.size(); i += i & (~i + 1))
+            m_ChunkTree[i] += difference;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextDocument::rebuildChunkTree()
+    {
+        m_ChunkTree.assign(m_Chunks.size() + 1, 0);
+
+        for (unsigned int i = 1; i < m_ChunkTree.size(); ++i)
+        {
+            m_ChunkTree[i] += m_Chunks[i-1].size();
+
+            unsigned int parent = i + (i & (~i + 1));
+            if (parent < m_ChunkTree.size())
+                m_ChunkTree[parent] += m_ChunkTree[i];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
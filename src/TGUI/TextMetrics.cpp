@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <TGUI/TextMetrics.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextMetrics::TextMetrics() :
+    m_Font         (nullptr),
+    m_CharacterSize(0)
+    {
+        std::fill(m_AsciiAdvances, m_AsciiAdvances + 128, -1.f);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMetrics::setFont(const sf::Font* font, unsigned int characterSize)
+    {
+        // Nothing has to be done when nothing changed
+        if ((m_Font == font) && (m_CharacterSize == characterSize))
+            return;
+
+        m_Font = font;
+        m_CharacterSize = characterSize;
+
+        // The old advances are no longer valid
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMetrics::invalidate()
+    {
+        std::fill(m_AsciiAdvances, m_AsciiAdvances + 128, -1.f);
+        m_Advances.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Font* TextMetrics::getFont() const
+    {
+        return m_Font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getAdvance(sf::Uint32 character)
+    {
+        // Without a font nothing can be measured
+        if (m_Font == nullptr)
+            return 0;
+
+        // Check if the character was already measured
+        if (character < 128)
+        {
+            if (m_AsciiAdvances[character] >= 0)
+                return m_AsciiAdvances[character];
+        }
+        else
+        {
+            auto it = m_Advances.find(character);
+            if (it != m_Advances.end())
+                return it->second;
+        }
+
+        // Measure the character like sf::Text does it
+        float advance;
+        if (character == ' ')
+            advance = static_cast<float>(m_Font->getGlyph(' ', m_CharacterSize, false).advance);
+        else if (character == '\t')
+            advance = static_cast<float>(m_Font->getGlyph(' ', m_CharacterSize, false).advance) * 4;
+        else if ((character == '\n') || (character == '\v'))
+            advance = 0;
+        else
+            advance = static_cast<float>(m_Font->getGlyph(character, m_CharacterSize, false).advance);
+
+        // Remember the advance for the next time
+        if (character < 128)
+            m_AsciiAdvances[character] = advance;
+        else
+            m_Advances[character] = advance;
+
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getAdvance(sf::Uint32 previous, sf::Uint32 character)
+    {
+        if (m_Font == nullptr)
+            return 0;
+
+        return getAdvance(character) + static_cast<float>(m_Font->getKerning(previous, character, m_CharacterSize));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,48 @@
 
 #include <TGUI/Defines.hpp>
 
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Adds a free part of an atlas page and merges it with the free parts next to it, so that the space of removed
+    // images can be used again for images that are larger than each of them
+    void addFreeRect(std::vector<sf::IntRect>& freeRects, sf::IntRect rect)
+    {
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (unsigned int i = 0; i < freeRects.size(); ++i)
+            {
+                const sf::IntRect& other = freeRects[i];
+                if ((other.top == rect.top) && (other.height == rect.height)
+                 && ((other.left + other.width == rect.left) || (rect.left + rect.width == other.left)))
+                {
+                    rect.left = std::min(rect.left, other.left);
+                    rect.width += other.width;
+                }
+                else if ((other.left == rect.left) && (other.width == rect.width)
+                      && ((other.top + other.height == rect.top) || (rect.top + rect.height == other.top)))
+                {
+                    rect.top = std::min(rect.top, other.top);
+                    rect.height += other.height;
+                }
+                else
+                    continue;
+
+                freeRects.erase(freeRects.begin() + i);
+                merged = true;
+                break;
+            }
+        }
+
+        freeRects.push_back(rect);
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -41,7 +83,7 @@ namespace tgui
     sf::Vector2u Texture::getSize() const
     {
         if (data != nullptr)
-            return data->texture.getSize();
+            return sf::Vector2u(data->textureRect.width, data->textureRect.height);
         else
             return sf::Vector2u(0, 0);
     }
@@ -58,6 +100,67 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Texture::setTextureRect(const sf::IntRect& rect)
+    {
+        if (data != nullptr)
+            sprite.setTextureRect(sf::IntRect(rect.left + data->textureRect.left, rect.top + data->textureRect.top, rect.width, rect.height));
+        else
+            sprite.setTextureRect(rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::IntRect Texture::getTextureRect() const
+    {
+        sf::IntRect rect = sprite.getTextureRect();
+
+        if (data != nullptr)
+        {
+            rect.left -= data->textureRect.left;
+            rect.top -= data->textureRect.top;
+        }
+
+        return rect;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::setRepeated(bool repeated)
+    {
+        if (data == nullptr)
+            return;
+
+        if (repeated)
+            TGUI_TextureManager.separateFromAtlas(*this);
+
+        data->texture.setRepeated(repeated);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::setSmooth(bool smooth)
+    {
+        if (data == nullptr)
+            return;
+
+        if (smooth)
+            TGUI_TextureManager.separateFromAtlas(*this);
+
+        data->texture.setSmooth(smooth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Texture::isSmooth() const
+    {
+        if (data != nullptr)
+            return data->getTexture().isSmooth();
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Texture::operator const sf::Sprite&() const
     {
         return sprite;
@@ -66,26 +169,57 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TextureManager::TextureManager() :
+    m_AtlasEnabled        (false),
+    m_MaximumAtlasPageSize(2048)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::enableAtlas(unsigned int maximumPageSize)
+    {
+        m_AtlasEnabled = true;
+        m_MaximumAtlasPageSize = maximumPageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::disableAtlas()
+    {
+        m_AtlasEnabled = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TextureManager::getTexture(const std::string& filename, Texture& texture, const sf::IntRect& rect)
+    {
+        return getTexture(filename, texture, rect, m_AtlasEnabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getTexture(const std::string& filename, Texture& texture, const sf::IntRect& rect, bool useAtlas)
     {
         // Look if we already had this image
         auto imageIt = m_ImageMap.find(filename);
         if (imageIt != m_ImageMap.end())
         {
-            // Loop all our textures to find the one containing the image
-            for (std::list<TextureData>::iterator it = imageIt->second.data.begin(); it != imageIt->second.data.end(); ++it)
+            // Only reuse the texture when the exact same part of the image is used (and it has its own texture if needed)
+            auto range = imageIt->second.data.equal_range(rect);
+            for (auto it = range.first; it != range.second; ++it)
             {
-                // Only reuse the texture when the exact same part of the image is used
-                if (it->rect == rect)
+                if (useAtlas || (it->second.atlasPage == nullptr))
                 {
                     // The texture is now used at multiple places
-                    ++(it->users);
+                    ++(it->second.users);
 
                     // We already have the texture, so pass the data
-                    texture.data = &(*it);
+                    texture.data = &it->second;
 
                     // Set the texture in the sprite
-                    texture.sprite.setTexture(it->texture, true);
+                    texture.sprite.setTexture(it->second.getTexture());
+                    texture.sprite.setTextureRect(it->second.textureRect);
 
                     return true;
                 }
@@ -97,26 +231,37 @@ namespace tgui
             imageIt = it.first;
         }
 
+        ImageMapData& imageData = imageIt->second;
+
+        // Only load the image when no other part of it was loaded yet
+        bool imageLoaded = !imageData.data.empty() || imageData.image.loadFromFile(filename);
+
         // Add new data to the list
-        imageIt->second.data.push_back(TextureData());
-        texture.data = &imageIt->second.data.back();
-        texture.data->image = &imageIt->second.image;
+        auto dataIt = imageData.data.insert(std::make_pair(rect, TextureData()));
+        texture.data = &dataIt->second;
+        texture.data->image = &imageData.image;
+        texture.data->imageData = &imageData;
         texture.data->rect = rect;
 
-        // load the image
-        if (texture.data->image->loadFromFile(filename))
+        if (imageLoaded)
         {
-            // Create a texture from the image
+            // Put the image in the atlas or create a separate texture from it
             bool success;
-            if (rect == sf::IntRect(0, 0, 0, 0))
-                success = texture.data->texture.loadFromImage(*texture.data->image);
+            if (useAtlas && addToAtlas(*texture.data))
+                success = true;
+            else if (rect == sf::IntRect(0, 0, 0, 0))
+                success = texture.data->texture.loadFromImage(imageData.image);
             else
-                success = texture.data->texture.loadFromImage(*texture.data->image, rect);
+                success = texture.data->texture.loadFromImage(imageData.image, rect);
 
             if (success)
             {
+                if (texture.data->atlasPage == nullptr)
+                    texture.data->textureRect = sf::IntRect(0, 0, texture.data->texture.getSize().x, texture.data->texture.getSize().y);
+
                 // Set the texture in the sprite
-                texture.sprite.setTexture(texture.data->texture, true);
+                texture.sprite.setTexture(texture.data->getTexture());
+                texture.sprite.setTextureRect(texture.data->textureRect);
 
                 // Set the other members of the data
                 texture.data->filename = filename;
@@ -126,7 +271,10 @@ namespace tgui
         }
 
         // The image couldn't be loaded
-        m_ImageMap.erase(imageIt);
+        imageData.data.erase(dataIt);
+        if (imageData.data.empty())
+            m_ImageMap.erase(imageIt);
+
         texture.data = nullptr;
         return false;
     }
@@ -142,58 +290,225 @@ namespace tgui
             return true;
         }
 
-        // Loop all our textures to check if we already have this one
-        for (auto imageIt = m_ImageMap.begin(); imageIt != m_ImageMap.end(); ++imageIt)
+        if (textureToCopy.data->imageData == nullptr)
+        {
+            TGUI_OUTPUT("TGUI warning: Can't copy texture that wasn't loaded by TextureManager.");
+            return false;
+        }
+
+        // The texture is now used at multiple places
+        ++(textureToCopy.data->users);
+        newTexture = textureToCopy;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(Texture& textureToRemove)
+    {
+        TextureData* data = textureToRemove.data;
+        if ((data == nullptr) || (data->imageData == nullptr))
+        {
+            TGUI_OUTPUT("TGUI warning: Can't remove texture that wasn't loaded by TextureManager.");
+            return;
+        }
+
+        // If this was the only place where the texture is used then delete it
+        if (--(data->users) == 0)
         {
-            for (auto dataIt = imageIt->second.data.begin(); dataIt != imageIt->second.data.end(); ++dataIt)
+            if (data->atlasPage != nullptr)
+                removeFromAtlas(*data);
+
+            // Remove the texture from the list, or even the whole image if it isn't used anywhere else
+            ImageMapData* imageData = data->imageData;
+            if (imageData->data.size() == 1)
             {
-                // Check if the pointer points to our texture
-                if (&(*dataIt) == textureToCopy.data)
+                std::string filename = data->filename;
+                m_ImageMap.erase(filename);
+            }
+            else
+            {
+                auto range = imageData->data.equal_range(data->rect);
+                for (auto it = range.first; it != range.second; ++it)
                 {
-                    // The texture is now used at multiple places
-                    ++(dataIt->users);
-                    newTexture = textureToCopy;
-                    return true;
+                    if (&it->second == data)
+                    {
+                        imageData->data.erase(it);
+                        break;
+                    }
                 }
             }
         }
 
-        TGUI_OUTPUT("TGUI warning: Can't copy texture that wasn't loaded by TextureManager.");
-        return false;
+        // The pointer is now useless
+        textureToRemove.data = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(Texture& textureToRemove)
+    bool TextureManager::separateFromAtlas(Texture& texture)
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_ImageMap.begin(); imageIt != m_ImageMap.end(); ++imageIt)
+        if ((texture.data == nullptr) || (texture.data->atlasPage == nullptr))
+            return true;
+
+        // Load the same part of the image again without using the atlas
+        Texture separateTexture;
+        if (!getTexture(texture.data->filename, separateTexture, texture.data->rect, false))
+            return false;
+
+        sf::IntRect textureRect = texture.getTextureRect();
+        removeTexture(texture);
+
+        // Only the texture inside the sprite changes, its position and scale remain the same
+        texture.data = separateTexture.data;
+        texture.sprite.setTexture(texture.data->texture);
+        texture.setTextureRect(textureRect);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(TextureData& data)
+    {
+        // Find out which part of the image has to be stored
+        sf::IntRect area(0, 0, data.image->getSize().x, data.image->getSize().y);
+        if (data.rect != sf::IntRect(0, 0, 0, 0))
         {
-            for (auto dataIt = imageIt->second.data.begin(); dataIt != imageIt->second.data.end(); ++dataIt)
+            sf::IntRect imageRect = area;
+            if (!imageRect.intersects(data.rect, area))
+                return false;
+        }
+
+        // Leave a pixel between the images so that they don't bleed into each other
+        int width = area.width + 1;
+        int height = area.height + 1;
+
+        int maximumSize = static_cast<int>(std::min(m_MaximumAtlasPageSize, sf::Texture::getMaximumSize()));
+        if ((width > maximumSize) || (height > maximumSize))
+            return false;
+
+        TextureAtlasPage* page = nullptr;
+        unsigned int freeRectIndex = 0;
+        while (page == nullptr)
+        {
+            // Search for the free part that fits the image best
+            int smallestLeftover = 0;
+            for (auto pageIt = m_AtlasPages.begin(); pageIt != m_AtlasPages.end(); ++pageIt)
             {
-                // Check if the pointer points to our texture
-                if (&(*dataIt) == textureToRemove.data)
+                for (unsigned int i = 0; i < pageIt->freeRects.size(); ++i)
                 {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
+                    const sf::IntRect& freeRect = pageIt->freeRects[i];
+                    if ((freeRect.width >= width) && (freeRect.height >= height))
                     {
-                        // Remove the texture from the list, or even the whole image if it isn't used anywhere else
-                        int usage = std::count_if(imageIt->second.data.begin(), imageIt->second.data.end(), [dataIt](TextureData& data){ return data.image == dataIt->image; });
-                        if (usage == 1)
-                            m_ImageMap.erase(imageIt);
-                        else
-                            imageIt->second.data.erase(dataIt);
+                        int leftover = (freeRect.width * freeRect.height) - (width * height);
+                        if ((page == nullptr) || (leftover < smallestLeftover))
+                        {
+                            page = &(*pageIt);
+                            freeRectIndex = i;
+                            smallestLeftover = leftover;
+                        }
                     }
+                }
+            }
+
+            if (page != nullptr)
+                break;
+
+            // The image doesn't fit anywhere, so grow the last page or start a new one
+            if (!m_AtlasPages.empty() && (static_cast<int>(m_AtlasPages.back().texture.getSize().x) * 2 <= maximumSize))
+            {
+                TextureAtlasPage& lastPage = m_AtlasPages.back();
+                int oldSize = lastPage.texture.getSize().x;
+
+                // The page is only kept on the graphics card, so its contents are read back from there
+                sf::Image newImage;
+                newImage.create(oldSize * 2, oldSize * 2, sf::Color::Transparent);
+                newImage.copy(lastPage.texture.copyToImage(), 0, 0);
+
+                // The texture object stays the same, so the sprites that use it remain valid
+                if (!lastPage.texture.loadFromImage(newImage))
+                    return false;
+
+                addFreeRect(lastPage.freeRects, sf::IntRect(oldSize, 0, oldSize, oldSize));
+                addFreeRect(lastPage.freeRects, sf::IntRect(0, oldSize, oldSize * 2, oldSize));
+            }
+            else
+            {
+                int size = std::min(512, maximumSize);
+                while ((size < width) || (size < height))
+                    size = std::min(size * 2, maximumSize);
+
+                m_AtlasPages.push_back(TextureAtlasPage());
+                TextureAtlasPage& newPage = m_AtlasPages.back();
+
+                sf::Image emptyImage;
+                emptyImage.create(size, size, sf::Color::Transparent);
+                if (!newPage.texture.loadFromImage(emptyImage))
+                {
+                    m_AtlasPages.pop_back();
+                    return false;
+                }
 
-                    // The pointer is now useless
-                    textureToRemove.data = nullptr;
+                newPage.freeRects.push_back(sf::IntRect(0, 0, size, size));
+            }
+        }
+
+        // Split the remaining part of the free rectangle along its shortest side
+        sf::IntRect freeRect = page->freeRects[freeRectIndex];
+        page->freeRects.erase(page->freeRects.begin() + freeRectIndex);
+
+        sf::IntRect rightPart;
+        sf::IntRect bottomPart;
+        if (freeRect.width - width < freeRect.height - height)
+        {
+            rightPart = sf::IntRect(freeRect.left + width, freeRect.top, freeRect.width - width, height);
+            bottomPart = sf::IntRect(freeRect.left, freeRect.top + height, freeRect.width, freeRect.height - height);
+        }
+        else
+        {
+            rightPart = sf::IntRect(freeRect.left + width, freeRect.top, freeRect.width - width, freeRect.height);
+            bottomPart = sf::IntRect(freeRect.left, freeRect.top + height, width, freeRect.height - height);
+        }
+
+        if ((rightPart.width > 0) && (rightPart.height > 0))
+            page->freeRects.push_back(rightPart);
+        if ((bottomPart.width > 0) && (bottomPart.height > 0))
+            page->freeRects.push_back(bottomPart);
+
+        // Upload the image to its place in the page
+        sf::Image part;
+        part.create(area.width, area.height);
+        part.copy(*data.image, 0, 0, area);
+        page->texture.update(part, static_cast<unsigned int>(freeRect.left), static_cast<unsigned int>(freeRect.top));
+
+        data.atlasPage = page;
+        data.textureRect = sf::IntRect(freeRect.left, freeRect.top, area.width, area.height);
+        ++page->entries;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeFromAtlas(TextureData& data)
+    {
+        TextureAtlasPage* page = data.atlasPage;
+        data.atlasPage = nullptr;
+
+        // When the page is no longer used then it is removed completely
+        if (--(page->entries) == 0)
+        {
+            for (auto it = m_AtlasPages.begin(); it != m_AtlasPages.end(); ++it)
+            {
+                if (&(*it) == page)
+                {
+                    m_AtlasPages.erase(it);
                     return;
                 }
             }
         }
 
-        TGUI_OUTPUT("TGUI warning: Can't remove texture that wasn't loaded by TextureManager.");
-        return;
+        // Sprites may still be pointing at the page (and they can't be moved), so only the place of this image is freed
+        addFreeRect(page->freeRects, sf::IntRect(data.textureRect.left, data.textureRect.top, data.textureRect.width + 1, data.textureRect.height + 1));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
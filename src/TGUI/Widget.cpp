@@ -23,14 +23,95 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+#include <algorithm>
+#include <limits>
+
+#ifdef TGUI_USE_WIDGET_POOL
+    #include <mutex>
+    #include <vector>
+    #include <functional>
+#endif
+
 #include <TGUI/Widget.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Container.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Ids of the properties of the widget
+    enum WidgetProperty
+    {
+        Property_Left = 1,
+        Property_Top,
+        Property_Width,
+        Property_Height,
+        Property_Visible,
+        Property_Enabled,
+        Property_Transparency,
+        Property_Callback,
+        Property_CallbackId
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const tgui::PropertyTable& getWidgetProperties()
+    {
+        static const tgui::PropertyTable properties =
+        {
+            {"Left",         "int",    Property_Left},
+            {"Top",          "int",    Property_Top},
+            {"Width",        "uint",   Property_Width},
+            {"Height",       "uint",   Property_Height},
+            {"Visible",      "bool",   Property_Visible},
+            {"Enabled",      "bool",   Property_Enabled},
+            {"Transparency", "byte",   Property_Transparency},
+            {"Callback",     "custom", Property_Callback},
+            {"CallbackId",   "uint",   Property_CallbackId}
+        };
+
+        return properties;
+    }
+
+#ifdef TGUI_USE_WIDGET_POOL
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Widgets are rounded up to a multiple of this size, bigger widgets are allocated on the normal heap
+    const std::size_t poolGranularity = 64;
+    const std::size_t poolSizeClasses = 64;
+    const std::size_t poolSlotsPerBlock = 32;
+
+    // A released slot stores the pointer to the next free slot of the same size
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+    struct WidgetPool
+    {
+        std::mutex         mutex;
+        FreeSlot*          freeLists[poolSizeClasses];
+        std::vector<char*> blocks[poolSizeClasses];
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetPool& getWidgetPool()
+    {
+        // The pool is never destroyed, widgets that live in global objects may still be released after main returns
+        static WidgetPool* pool = new WidgetPool();
+        return *pool;
+    }
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
+    const sf::Time Widget::NoDeadline = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Widget() :
@@ -44,9 +125,11 @@ namespace tgui
     m_MouseDown      (false),
     m_Focused        (false),
     m_AllowFocus     (false),
+    m_NeedsUpdates   (false),
     m_AnimatedWidget (false),
     m_DraggableWidget(false),
-    m_ContainerWidget(false)
+    m_ContainerWidget(false),
+    m_RefCount       (0)
     {
         m_Callback.widget = nullptr;
         m_Callback.widgetType = Type_Unknown;
@@ -69,9 +152,11 @@ namespace tgui
     m_MouseDown      (false),
     m_Focused        (false),
     m_AllowFocus     (copy.m_AllowFocus),
+    m_NeedsUpdates   (false),
     m_AnimatedWidget (copy.m_AnimatedWidget),
     m_DraggableWidget(copy.m_DraggableWidget),
-    m_ContainerWidget(copy.m_ContainerWidget)
+    m_ContainerWidget(copy.m_ContainerWidget),
+    m_RefCount       (0)
     {
         m_Callback.widget = nullptr;
     }
@@ -84,6 +169,120 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void* Widget::operator new(std::size_t size)
+    {
+#ifdef TGUI_USE_WIDGET_POOL
+        const std::size_t sizeClass = (size + poolGranularity - 1) / poolGranularity;
+        if ((sizeClass == 0) || (sizeClass > poolSizeClasses))
+            return ::operator new(size);
+
+        WidgetPool& pool = getWidgetPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        FreeSlot*& freeList = pool.freeLists[sizeClass - 1];
+        if (freeList == nullptr)
+        {
+            // Allocate a new block and chain all of its slots together. Blocks are kept until releaseUnusedPoolMemory is called.
+            const std::size_t slotSize = sizeClass * poolGranularity;
+            char* block = static_cast<char*>(::operator new(slotSize * poolSlotsPerBlock));
+            pool.blocks[sizeClass - 1].push_back(block);
+
+            for (std::size_t i = 0; i < poolSlotsPerBlock; ++i)
+            {
+                FreeSlot* slot = reinterpret_cast<FreeSlot*>(block + i * slotSize);
+                slot->next = (i + 1 < poolSlotsPerBlock) ? reinterpret_cast<FreeSlot*>(block + (i + 1) * slotSize) : nullptr;
+            }
+
+            freeList = reinterpret_cast<FreeSlot*>(block);
+        }
+
+        FreeSlot* slot = freeList;
+        freeList = slot->next;
+        return slot;
+#else
+        return ::operator new(size);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::operator delete(void* pointer, std::size_t size)
+    {
+        if (pointer == nullptr)
+            return;
+
+#ifdef TGUI_USE_WIDGET_POOL
+        const std::size_t sizeClass = (size + poolGranularity - 1) / poolGranularity;
+        if ((sizeClass == 0) || (sizeClass > poolSizeClasses))
+        {
+            ::operator delete(pointer);
+            return;
+        }
+
+        WidgetPool& pool = getWidgetPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        FreeSlot* slot = static_cast<FreeSlot*>(pointer);
+        slot->next = pool.freeLists[sizeClass - 1];
+        pool.freeLists[sizeClass - 1] = slot;
+#else
+        (void)size;
+        ::operator delete(pointer);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::releaseUnusedPoolMemory()
+    {
+#ifdef TGUI_USE_WIDGET_POOL
+        WidgetPool& pool = getWidgetPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        for (std::size_t sizeClass = 0; sizeClass < poolSizeClasses; ++sizeClass)
+        {
+            std::vector<char*>& blocks = pool.blocks[sizeClass];
+            if (blocks.empty())
+                continue;
+
+            // Find the block of every free slot by its address
+            std::sort(blocks.begin(), blocks.end(), std::less<char*>());
+            auto findBlock = [&blocks](FreeSlot* slot)
+                {
+                    return std::upper_bound(blocks.begin(), blocks.end(), reinterpret_cast<char*>(slot), std::less<char*>()) - blocks.begin() - 1;
+                };
+
+            std::vector<std::size_t> freeSlots(blocks.size(), 0);
+            for (FreeSlot* slot = pool.freeLists[sizeClass]; slot != nullptr; slot = slot->next)
+                ++freeSlots[findBlock(slot)];
+
+            // Take the slots of the blocks without any widget out of the free list
+            FreeSlot** next = &pool.freeLists[sizeClass];
+            while (*next != nullptr)
+            {
+                if (freeSlots[findBlock(*next)] == poolSlotsPerBlock)
+                    *next = (*next)->next;
+                else
+                    next = &(*next)->next;
+            }
+
+            // Those blocks can now be returned to the heap
+            std::size_t usedBlocks = 0;
+            for (std::size_t i = 0; i < blocks.size(); ++i)
+            {
+                if (freeSlots[i] == poolSlotsPerBlock)
+                    ::operator delete(blocks[i]);
+                else
+                    blocks[usedBlocks++] = blocks[i];
+            }
+
+            blocks.resize(usedBlocks);
+        }
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget& Widget::operator= (const Widget& right)
     {
         // Make sure it is not the same widget
@@ -93,6 +292,10 @@ namespace tgui
             this->Transformable::operator=(right);
             this->CallbackManager::operator=(right);
 
+            // The widget that was copied may need updates for a reason that no longer applies to this one (e.g. focus).
+            // This has to happen before the parent is changed, so that the current parent stops updating the widget.
+            setNeedsUpdates(false);
+
             m_Enabled             = right.m_Enabled;
             m_Visible             = right.m_Visible;
             m_Loaded              = right.m_Loaded;
@@ -110,6 +313,8 @@ namespace tgui
             m_Callback.widget     = nullptr;
             m_Callback.widgetType = right.m_Callback.widgetType;
             m_Callback.id         = right.m_Callback.id;
+
+            markDirty();
         }
 
         return *this;
@@ -117,9 +322,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setPosition(float x, float y)
+    {
+        Transformable::setPosition(x, y);
+        markParentDirty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::show()
     {
         m_Visible = true;
+        markParentDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,6 +341,7 @@ namespace tgui
     void Widget::hide()
     {
         m_Visible = false;
+        markParentDirty();
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -144,6 +359,7 @@ namespace tgui
     void Widget::enable()
     {
         m_Enabled = true;
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -151,6 +367,7 @@ namespace tgui
     void Widget::disable()
     {
         m_Enabled = false;
+        markDirty();
 
         // Change the mouse button state.
         m_MouseHover = false;
@@ -193,7 +410,7 @@ namespace tgui
 
     void Widget::unfocus()
     {
-        if (m_Focused)
+        if (m_Focused && m_Parent)
             m_Parent->unfocusWidgets();
     }
 
@@ -223,6 +440,7 @@ namespace tgui
     void Widget::setTransparency(unsigned char transparency)
     {
         m_Opacity = transparency;
+        markParentDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -236,14 +454,61 @@ namespace tgui
 
     void Widget::moveToFront()
     {
-        m_Parent->moveWidgetToFront(this);
+        if (m_Parent)
+            m_Parent->moveWidgetToFront(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::moveToBack()
     {
-        m_Parent->moveWidgetToBack(this);
+        if (m_Parent)
+            m_Parent->moveWidgetToBack(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::markDirty()
+    {
+        // Only containers remember that something changed. The container itself and all containers around it
+        // have to be drawn again, which are only a few, so the whole chain is marked every time.
+        if (m_ContainerWidget)
+            static_cast<Container*>(this)->m_NeedsRedraw = true;
+
+        markParentDirty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::markParentDirty()
+    {
+        // The widget may have been moved or resized
+        if (m_Parent != nullptr)
+            m_Parent->widgetChanged(this);
+
+        Container* container = m_Parent;
+        while (container != nullptr)
+        {
+            container->m_NeedsRedraw = true;
+            container = container->m_Parent;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ClipStack* Widget::getClipStack() const
+    {
+        // The stack is placed in the container that is being drawn, which is the parent or one of the containers around it
+        Container* container = m_Parent;
+        while (container != nullptr)
+        {
+            if (container->m_ClipStack != nullptr)
+                return container->m_ClipStack;
+
+            container = container->m_Parent;
+        }
+
+        return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,6 +533,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Widget::getTimeUntilUpdate() const
+    {
+        return sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::addCallback()
     {
         // Loop through all callback functions
@@ -277,7 +549,7 @@ namespace tgui
             // Pass the callback to the correct place
             if (*func != nullptr)
                 (*func)();
-            else
+            else if (m_Parent)
                 m_Parent->addChildCallback(m_Callback);
         }
     }
@@ -286,6 +558,9 @@ namespace tgui
 
     void Widget::mouseEnteredWidget()
     {
+        // The widget looks different while the mouse is on top of it
+        markParentDirty();
+
         if (m_CallbackFunctions[MouseEntered].empty() == false)
         {
             m_Callback.trigger = MouseEntered;
@@ -297,6 +572,8 @@ namespace tgui
 
     void Widget::mouseLeftWidget()
     {
+        markParentDirty();
+
         if (m_CallbackFunctions[MouseLeft].empty() == false)
         {
             m_Callback.trigger = MouseLeft;
@@ -389,71 +666,81 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Widget::setProperty(std::string property, const std::string& value)
+    bool Widget::setProperty(const std::string& property, const std::string& value)
     {
-        property = toLower(property);
-
-        if (property == "left")
-        {
-            setPosition(static_cast<float>(atof(value.c_str())), getPosition().y);
-        }
-        else if (property == "top")
+        switch (getWidgetProperties().find(property))
         {
-            setPosition(getPosition().x, static_cast<float>(atof(value.c_str())));
-        }
-        else if (property == "width")
-        {
-            setSize(static_cast<float>(atof(value.c_str())), getSize().y);
-        }
-        else if (property == "height")
-        {
-            setSize(getSize().x, static_cast<float>(atof(value.c_str())));
-        }
-        else if (property == "visible")
-        {
-            if ((value == "true") || (value == "True"))
-                m_Visible = true;
-            else if ((value == "false") || (value == "False"))
-                m_Visible = false;
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Visible' property.");
-        }
-        else if (property == "enabled")
-        {
-            if ((value == "true") || (value == "True"))
-                m_Enabled = true;
-            else if ((value == "false") || (value == "False"))
-                m_Enabled = false;
-            else
-                TGUI_OUTPUT("TGUI error: Failed to parse 'Enabled' property.");
-        }
-        else if (property == "transparency")
-        {
-            setTransparency(static_cast<char>(atoi(value.c_str())));
-        }
-        else if (property == "callbackid")
-        {
-            m_Callback.id = static_cast<unsigned int>(std::atoi(value.c_str()));
-        }
-        else if (property == "callback")
-        {
-            std::vector<sf::String> callbacks;
-            decodeList(value, callbacks);
-
-            for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+            case Property_Left:
+            {
+                setPosition(static_cast<float>(atof(value.c_str())), getPosition().y);
+                break;
+            }
+            case Property_Top:
+            {
+                setPosition(getPosition().x, static_cast<float>(atof(value.c_str())));
+                break;
+            }
+            case Property_Width:
+            {
+                setSize(static_cast<float>(atof(value.c_str())), getSize().y);
+                break;
+            }
+            case Property_Height:
             {
-                if ((*it == "Focused") || (*it == "focused"))
-                    bindCallback(Focused);
-                else if ((*it == "Unfocused") || (*it == "unfocused"))
-                    bindCallback(Unfocused);
-                else if ((*it == "MouseEntered") || (*it == "mouseentered"))
-                    bindCallback(MouseEntered);
-                else if ((*it == "MouseLeft") || (*it == "mouseleft"))
-                    bindCallback(MouseLeft);
+                setSize(getSize().x, static_cast<float>(atof(value.c_str())));
+                break;
             }
+            case Property_Visible:
+            {
+                if ((value == "true") || (value == "True"))
+                    show();
+                else if ((value == "false") || (value == "False"))
+                    hide();
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Visible' property.");
+                break;
+            }
+            case Property_Enabled:
+            {
+                if ((value == "true") || (value == "True"))
+                    enable();
+                else if ((value == "false") || (value == "False"))
+                    disable();
+                else
+                    TGUI_OUTPUT("TGUI error: Failed to parse 'Enabled' property.");
+                break;
+            }
+            case Property_Transparency:
+            {
+                setTransparency(static_cast<char>(atoi(value.c_str())));
+                break;
+            }
+            case Property_CallbackId:
+            {
+                m_Callback.id = static_cast<unsigned int>(std::atoi(value.c_str()));
+                break;
+            }
+            case Property_Callback:
+            {
+                std::vector<sf::String> callbacks;
+                decodeList(value, callbacks);
+
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it)
+                {
+                    if ((*it == "Focused") || (*it == "focused"))
+                        bindCallback(Focused);
+                    else if ((*it == "Unfocused") || (*it == "unfocused"))
+                        bindCallback(Unfocused);
+                    else if ((*it == "MouseEntered") || (*it == "mouseentered"))
+                        bindCallback(MouseEntered);
+                    else if ((*it == "MouseLeft") || (*it == "mouseleft"))
+                        bindCallback(MouseLeft);
+                }
+                break;
+            }
+            default: // The property didn't match
+                return false;
         }
-        else // The property didn't match
-            return false;
 
         // You pass here when one of the properties matched
         return true;
@@ -461,43 +748,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Widget::getProperty(std::string property, std::string& value) const
+    bool Widget::getProperty(const std::string& property, std::string& value) const
     {
-        property = toLower(property);
-
-        if (property == "left")
-            value = to_string(getPosition().x);
-        else if (property == "top")
-            value = to_string(getPosition().y);
-        else if (property == "width")
-            value = to_string(getSize().x);
-        else if (property == "height")
-            value = to_string(getSize().y);
-        else if (property == "visible")
-            value = m_Visible ? "true" : "false";
-        else if (property == "enabled")
-            value = m_Enabled ? "true" : "false";
-        else if (property == "transparency")
-            value = to_string(int(getTransparency()));
-        else if (property == "callbackid")
-            value = to_string(m_Callback.id);
-        else if (property == "callback")
+        switch (getWidgetProperties().find(property))
         {
-            std::vector<sf::String> callbacks;
-
-            if ((m_CallbackFunctions.find(Focused) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Focused).size() == 1) && (m_CallbackFunctions.at(Focused).front() == nullptr))
-                callbacks.push_back("Focused");
-            if ((m_CallbackFunctions.find(Unfocused) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Unfocused).size() == 1) && (m_CallbackFunctions.at(Unfocused).front() == nullptr))
-                callbacks.push_back("Unfocused");
-            if ((m_CallbackFunctions.find(MouseEntered) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MouseEntered).size() == 1) && (m_CallbackFunctions.at(MouseEntered).front() == nullptr))
-                callbacks.push_back("MouseEntered");
-            if ((m_CallbackFunctions.find(MouseLeft) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MouseLeft).size() == 1) && (m_CallbackFunctions.at(MouseLeft).front() == nullptr))
-                callbacks.push_back("MouseLeft");
-
-            encodeList(callbacks, value);
+            case Property_Left:
+                value = to_string(getPosition().x);
+                break;
+            case Property_Top:
+                value = to_string(getPosition().y);
+                break;
+            case Property_Width:
+                value = to_string(getSize().x);
+                break;
+            case Property_Height:
+                value = to_string(getSize().y);
+                break;
+            case Property_Visible:
+                value = m_Visible ? "true" : "false";
+                break;
+            case Property_Enabled:
+                value = m_Enabled ? "true" : "false";
+                break;
+            case Property_Transparency:
+                value = to_string(int(getTransparency()));
+                break;
+            case Property_CallbackId:
+                value = to_string(m_Callback.id);
+                break;
+            case Property_Callback:
+            {
+                std::vector<sf::String> callbacks;
+
+                if ((m_CallbackFunctions.find(Focused) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Focused).size() == 1) && (m_CallbackFunctions.at(Focused).front() == nullptr))
+                    callbacks.push_back("Focused");
+                if ((m_CallbackFunctions.find(Unfocused) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Unfocused).size() == 1) && (m_CallbackFunctions.at(Unfocused).front() == nullptr))
+                    callbacks.push_back("Unfocused");
+                if ((m_CallbackFunctions.find(MouseEntered) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MouseEntered).size() == 1) && (m_CallbackFunctions.at(MouseEntered).front() == nullptr))
+                    callbacks.push_back("MouseEntered");
+                if ((m_CallbackFunctions.find(MouseLeft) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MouseLeft).size() == 1) && (m_CallbackFunctions.at(MouseLeft).front() == nullptr))
+                    callbacks.push_back("MouseLeft");
+
+                encodeList(callbacks, value);
+                break;
+            }
+            default: // The property didn't match
+                return false;
         }
-        else // The property didn't match
-            return false;
 
         // You pass here when one of the properties matched
         return true;
@@ -508,15 +805,7 @@ namespace tgui
     std::list< std::pair<std::string, std::string> > Widget::getPropertyList() const
     {
         std::list< std::pair<std::string, std::string> > list;
-        list.push_back(std::pair<std::string, std::string>("Left", "int"));
-        list.push_back(std::pair<std::string, std::string>("Top", "int"));
-        list.push_back(std::pair<std::string, std::string>("Width", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Height", "uint"));
-        list.push_back(std::pair<std::string, std::string>("Visible", "bool"));
-        list.push_back(std::pair<std::string, std::string>("Enabled", "bool"));
-        list.push_back(std::pair<std::string, std::string>("Transparency", "byte"));
-        list.push_back(std::pair<std::string, std::string>("Callback", "custom"));
-        list.push_back(std::pair<std::string, std::string>("CallbackId", "uint"));
+        getWidgetProperties().addToPropertyList(list);
         return list;
     }
 
@@ -527,6 +816,60 @@ namespace tgui
         m_Parent = parent;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::setNeedsUpdates(bool needsUpdates)
+    {
+        if (m_NeedsUpdates == needsUpdates)
+            return;
+
+        m_NeedsUpdates = needsUpdates;
+
+        if (m_Parent)
+            m_Parent->setWidgetNeedsUpdates(this, needsUpdates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::drawSprites(sf::RenderTarget& target, sf::RenderStates states, std::initializer_list<const sf::Sprite*> sprites) const
+    {
+        std::vector<sf::Vertex>& vertices = m_SpriteVertices;
+
+        for (auto first = sprites.begin(); first != sprites.end(); ++first)
+        {
+            // Sprites without a texture aren't drawn, and the texture may have been drawn together with an earlier sprite
+            const sf::Texture* texture = (*first)->getTexture();
+            if ((texture == nullptr) || (std::find_if(sprites.begin(), first, [texture](const sf::Sprite* sprite){ return sprite->getTexture() == texture; }) != first))
+                continue;
+
+            // Collect the quads of all sprites with this texture
+            vertices.clear();
+            for (auto it = first; it != sprites.end(); ++it)
+            {
+                if ((*it)->getTexture() != texture)
+                    continue;
+
+                const sf::Sprite& sprite = **it;
+                const sf::Transform& transform = sprite.getTransform();
+                sf::FloatRect bounds = sprite.getLocalBounds();
+                sf::IntRect rect = sprite.getTextureRect();
+
+                float left = static_cast<float>(rect.left);
+                float top = static_cast<float>(rect.top);
+                float right = static_cast<float>(rect.left + rect.width);
+                float bottom = static_cast<float>(rect.top + rect.height);
+
+                vertices.push_back(sf::Vertex(transform.transformPoint(0, 0), sprite.getColor(), sf::Vector2f(left, top)));
+                vertices.push_back(sf::Vertex(transform.transformPoint(0, bounds.height), sprite.getColor(), sf::Vector2f(left, bottom)));
+                vertices.push_back(sf::Vertex(transform.transformPoint(bounds.width, bounds.height), sprite.getColor(), sf::Vector2f(right, bottom)));
+                vertices.push_back(sf::Vertex(transform.transformPoint(bounds.width, 0), sprite.getColor(), sf::Vector2f(right, top)));
+            }
+
+            states.texture = texture;
+            target.draw(&vertices[0], vertices.size(), sf::Quads, states);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -546,6 +889,36 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetBorders::drawBorders(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Vector2f& size, const sf::Color& color) const
+    {
+        float left = static_cast<float>(m_LeftBorder);
+        float top = static_cast<float>(m_TopBorder);
+        float right = static_cast<float>(m_RightBorder);
+        float bottom = static_cast<float>(m_BottomBorder);
+
+        // The left border, the top border, the right border and the bottom border
+        const sf::FloatRect borders[] = {sf::FloatRect(-left, -top, left, size.y + top),
+                                         sf::FloatRect(0, -top, size.x + right, top),
+                                         sf::FloatRect(size.x, 0, right, size.y + bottom),
+                                         sf::FloatRect(-left, size.y, size.x + left, bottom)};
+
+        sf::Vertex vertices[16];
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            vertices[4*i].position = sf::Vector2f(borders[i].left, borders[i].top);
+            vertices[4*i+1].position = sf::Vector2f(borders[i].left, borders[i].top + borders[i].height);
+            vertices[4*i+2].position = sf::Vector2f(borders[i].left + borders[i].width, borders[i].top + borders[i].height);
+            vertices[4*i+3].position = sf::Vector2f(borders[i].left + borders[i].width, borders[i].top);
+
+            for (unsigned int j = 0; j < 4; ++j)
+                vertices[4*i+j].color = color;
+        }
+
+        target.draw(vertices, 16, sf::Quads, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////